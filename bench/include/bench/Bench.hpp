@@ -0,0 +1,62 @@
+#pragma once
+
+#include "utility/Stream.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace bench
+{
+// Joins `count` copies of the input, each of them starting on a new line.
+inline std::string repeat_input(std::string_view input, std::int64_t count)
+{
+    std::string result;
+    result.reserve(static_cast<std::size_t>(count) * (input.size() + 1));
+    for (auto index = 0; index < count; ++index)
+    {
+        if (index > 0)
+        {
+            result += '\n';
+        }
+        result.append(input);
+    }
+    return result;
+}
+
+inline std::int64_t count_lines(std::string_view input)
+{
+    return std::ranges::count(input, '\n') + 1;
+}
+
+// Example input scaled by the first argument of the benchmark.
+inline std::string get_input(const benchmark::State& state, std::string_view example)
+{
+    return repeat_input(example, state.range(0));
+}
+
+// Reports bytes/s, lines/s and time per line, given that every iteration processed the whole input once.
+inline void set_throughput(benchmark::State& state, std::string_view input)
+{
+    const auto line_count = count_lines(input);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(input.size()));
+    state.SetItemsProcessed(state.iterations() * line_count);
+    state.counters["time/line"] = benchmark::Counter(
+        static_cast<double>(line_count),
+        benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+// Measures a whole `task::solve_partN` call on the scaled example input.
+template <typename Solve>
+void solve(benchmark::State& state, std::string_view example, Solve&& solve_part)
+{
+    const auto input = get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(solve_part(stream));
+    }
+    set_throughput(state, input);
+}
+} // namespace bench
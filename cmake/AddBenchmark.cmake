@@ -0,0 +1,31 @@
+function(add_benchmark)
+    cmake_parse_arguments(
+        "ARG"
+        ""
+        "DAY_ID"
+        "INCLUDES;SOURCES"
+        ${ARGN}
+    )
+
+    set(TARGET_NAME "d${ARG_DAY_ID}bench")
+    add_executable("${TARGET_NAME}" "${ARG_SOURCES}")
+    set_target_properties(
+        "${TARGET_NAME}"
+        PROPERTIES
+        OUTPUT_NAME "bench"
+    )
+
+    target_include_directories(
+        "${TARGET_NAME}"
+        PRIVATE
+            "${CMAKE_CURRENT_SOURCE_DIR}/include"
+            ${ARG_INCLUDES}
+    )
+
+    target_link_libraries(
+        "${TARGET_NAME}"
+        "day${ARG_DAY_ID}"
+        "bench"
+        "utility"
+    )
+endfunction(add_benchmark)
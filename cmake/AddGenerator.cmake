@@ -0,0 +1,23 @@
+function(add_generator)
+    cmake_parse_arguments(
+        "ARG"
+        ""
+        "DAY_ID"
+        "SOURCES"
+        ${ARGN}
+    )
+
+    set(TARGET_NAME "d${ARG_DAY_ID}gen")
+    add_executable("${TARGET_NAME}" "${ARG_SOURCES}")
+    set_target_properties(
+        "${TARGET_NAME}"
+        PROPERTIES
+        OUTPUT_NAME "gen"
+    )
+
+    target_link_libraries(
+        "${TARGET_NAME}"
+        "gen"
+        "utility"
+    )
+endfunction(add_generator)
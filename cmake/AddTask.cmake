@@ -5,6 +5,40 @@ function(parse_day_id)
     set(${ARG_RETVALUE} ${ID} PARENT_SCOPE)
 endfunction(parse_day_id)
 
+function(add_day)
+    cmake_parse_arguments(
+        "ARG"
+        ""
+        "DAY_ID"
+        "SOURCES"
+        ${ARGN}
+    )
+
+    set(TARGET_NAME "day${ARG_DAY_ID}")
+    add_library("${TARGET_NAME}" OBJECT "${ARG_SOURCES}")
+
+    target_include_directories(
+        "${TARGET_NAME}"
+        PUBLIC "${CMAKE_CURRENT_SOURCE_DIR}/include"
+    )
+
+    # Without the replacement of operator new and delete, which each executable or library linking the day picks
+    # through its own utility library.
+    target_link_libraries(
+        "${TARGET_NAME}"
+        PUBLIC "utility_objects"
+    )
+
+    # Linked into the shared solver library as well as into the executables.
+    set_target_properties(
+        "${TARGET_NAME}"
+        PROPERTIES
+        POSITION_INDEPENDENT_CODE ON
+    )
+
+    set_property(GLOBAL APPEND PROPERTY DAY_LIBRARIES "${TARGET_NAME}")
+endfunction(add_day)
+
 function(add_task)
     cmake_parse_arguments(
         "ARG"
@@ -30,6 +64,48 @@ function(add_task)
 
     target_link_libraries(
         "${TARGET_NAME}"
+        "day${ARG_DAY_ID}"
         "utility"
     )
+
+    # Names the solver in the keys of cached answers.
+    target_compile_definitions(
+        "${TARGET_NAME}"
+        PRIVATE AOC_SOLVER_NAME="${TARGET_NAME}"
+    )
 endfunction(add_task)
+
+# Executable which solves both parts of the day from a single parse of the input.
+function(add_combined_task)
+    cmake_parse_arguments(
+        "ARG"
+        ""
+        "DAY_ID"
+        "SOURCES"
+        ${ARGN}
+    )
+
+    set(TARGET_NAME "d${ARG_DAY_ID}both")
+    add_executable("${TARGET_NAME}" "${ARG_SOURCES}")
+    set_target_properties(
+        "${TARGET_NAME}"
+        PROPERTIES
+        OUTPUT_NAME "both"
+    )
+
+    target_include_directories(
+        "${TARGET_NAME}"
+        PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include"
+    )
+
+    target_link_libraries(
+        "${TARGET_NAME}"
+        "day${ARG_DAY_ID}"
+        "utility"
+    )
+
+    target_compile_definitions(
+        "${TARGET_NAME}"
+        PRIVATE AOC_SOLVER_NAME="${TARGET_NAME}"
+    )
+endfunction(add_combined_task)
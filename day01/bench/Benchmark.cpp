@@ -0,0 +1,48 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::DigitExtractor;
+using task::detail::extract_digit;
+using task::detail::extract_digit_or_word;
+using task::detail::get_digits;
+
+constexpr std::string_view example_part1{R"(1abc2
+pqr3stu8vwx
+a1b2c3d4e5f
+treb7uchet)"};
+
+constexpr std::string_view example_part2{R"(two1nine
+eightwothree
+abcone2threexyz
+xtwone3four
+4nineeightseven2
+zoneight234
+7pqrstsixteen)"};
+
+void get_digits(benchmark::State& state, std::string_view example, const DigitExtractor& extractor)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        for (const auto line : stream)
+        {
+            benchmark::DoNotOptimize(get_digits(line, extractor));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(get_digits, part1, example_part1, DigitExtractor{extract_digit})->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(get_digits, part2, example_part2, DigitExtractor{extract_digit_or_word})->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example_part1, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example_part2, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,45 @@
+#include "gen/Generator.hpp"
+#include <array>
+#include <string_view>
+
+namespace
+{
+constexpr std::array<std::string_view, 9> digit_words{
+    "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+};
+
+// Lines of letters mixed with digits and spelled digits. Every line contains at least one digit.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    const auto line_count = gen::scaled(scale, 1000);
+    for (auto line = 0ull; line < line_count; ++line)
+    {
+        if (line > 0)
+        {
+            output.put('\n');
+        }
+        const auto length = gen::uniform(random, 4, 40);
+        const auto digit_position = gen::uniform(random, 0, length - 1);
+        for (auto position = 0ull; position < length; ++position)
+        {
+            if (position == digit_position or gen::chance(random, 0.05))
+            {
+                output.put(static_cast<char>('0' + gen::uniform(random, 1, 9)));
+            }
+            else if (gen::chance(random, 0.05))
+            {
+                output.write(gen::pick(random, digit_words));
+            }
+            else
+            {
+                output.put(static_cast<char>('a' + gen::uniform(random, 0, 25)));
+            }
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
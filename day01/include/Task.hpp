@@ -1,14 +1,27 @@
 #pragma once
 
+#include <string_view>
+#include <utility>
+
 namespace utility
 {
 class Stream;
 } // namespace utility
 
-namespace task
+namespace task::inline day01
 {
 using Answer = unsigned long;
+using Answers = std::pair<Answer, Answer>;
 Answer solve_part1(utility::Stream&);
 
 Answer solve_part2(utility::Stream&);
-} // namespace task
+
+// Answers of both parts from a single parse of the input.
+Answers solve_both(utility::Stream&);
+
+// Term of a single line in part 1, whose answer is the sum of the terms of all lines.
+Answer get_line_term_part1(std::string_view line);
+
+// Term of a single line in part 2, whose answer is the sum of the terms of all lines.
+Answer get_line_term_part2(std::string_view line);
+} // namespace task::day01
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day01::detail
+{
+using DigitExtractor = std::function<std::optional<int> (const std::string_view&)>;
+
+std::pair<int, int> get_digits(std::string_view, const DigitExtractor&);
+
+std::optional<int> extract_digit(const std::string_view&);
+
+std::optional<int> extract_digit_or_word(const std::string_view&);
+} // namespace task::day01::detail
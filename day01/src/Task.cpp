@@ -1,16 +1,18 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
 #include <functional>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <vector>
 
-namespace
+namespace task::inline day01::detail
 {
-using DigitExtractor = std::function<std::optional<int> (const std::string_view&)>;
-
-int get_first_digit(const std::string& string, const DigitExtractor& extractor)
+int get_first_digit(std::string_view string, const DigitExtractor& extractor)
 {
     for (auto itr = string.begin(); itr != string.end(); ++itr)
     {
@@ -23,9 +25,9 @@ int get_first_digit(const std::string& string, const DigitExtractor& extractor)
     throw std::logic_error{"String does not contain a digit"};
 }
 
-int get_last_digit(const std::string& string, const DigitExtractor& extractor)
+int get_last_digit(std::string_view string, const DigitExtractor& extractor)
 {
-    for (auto length = std::string::size_type{1}; length <= string.length(); ++length)
+    for (auto length = std::string_view::size_type{1}; length <= string.length(); ++length)
     {
         const auto maybe_digit = extractor(std::string_view{string.end() - length, string.end()});
         if (maybe_digit.has_value())
@@ -36,7 +38,7 @@ int get_last_digit(const std::string& string, const DigitExtractor& extractor)
     throw std::logic_error{"String does not contain a digit"};
 }
 
-auto get_digits(const std::string& string, const DigitExtractor& extractor)
+std::pair<int, int> get_digits(std::string_view string, const DigitExtractor& extractor)
 {
     const auto first_digit = get_first_digit(string, extractor);
     const auto last_digit = get_last_digit(string, extractor);
@@ -66,50 +68,77 @@ const std::vector<std::pair<std::string, int>> digit_word_map
     {"nine", 9}
 };
 
-auto accumulate(utility::Stream& stream, DigitExtractor&& digit_extractor)
+std::optional<int> extract_digit(const std::string_view& string)
 {
-    auto sum = 0ul;
-    for (const auto& line : stream)
+    if (std::isdigit(string.front()))
     {
-        const auto digits = get_digits(line, std::move(digit_extractor));
-        const auto value = join_into_number(digits.first, digits.second);
-        sum += value;
+        return to_digit(string.front());
     }
-    return sum;
+    return std::nullopt;
 }
-} // namespace 
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+std::optional<int> extract_digit_or_word(const std::string_view& string)
 {
-    const auto digit_extractor = [](const std::string_view& string) -> std::optional<int> {
-        if (std::isdigit(string.front()))
+    if (std::isdigit(string.front()))
+    {
+        return to_digit(string.front());
+    }
+    for (const auto& [word, digit] : digit_word_map)
+    {
+        if (string.starts_with(word))
         {
-            return to_digit(string.front());
+            return digit;
         }
-        return std::nullopt;
-    };
-    return accumulate(stream, digit_extractor);
+    }
+    return std::nullopt;
+}
+
+auto get_calibration_value(std::string_view line, const DigitExtractor& digit_extractor)
+{
+    const auto digits = get_digits(line, digit_extractor);
+    return static_cast<unsigned long>(join_into_number(digits.first, digits.second));
+}
+
+auto accumulate(utility::Stream& stream, const DigitExtractor& digit_extractor)
+{
+    TIME_SCOPE("accumulate");
+    return utility::parallel_line_reduce(stream, 0ul, [&digit_extractor](std::string_view line) {
+        return get_calibration_value(line, digit_extractor);
+    });
+}
+} // namespace task::day01::detail
+
+namespace task::inline day01
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    return accumulate(stream, extract_digit);
 }
 
 Answer solve_part2(utility::Stream& stream)
 {
-    const auto digit_extractor = [](const std::string_view& string) -> std::optional<int> {
-        if (std::isdigit(string.front()))
-        {
-            return to_digit(string.front());
-        }
-        for (const auto& [word, digit] : digit_word_map)
-        {
-            if (string.starts_with(word))
-            {
-                return digit;
-            }
-        }
-        return std::nullopt;
+    return accumulate(stream, extract_digit_or_word);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    TIME_SCOPE("accumulate");
+    const auto get_calibration_values = [](std::string_view line) {
+        return Answers{get_calibration_value(line, extract_digit), get_calibration_value(line, extract_digit_or_word)};
     };
-    return accumulate(stream, digit_extractor);
+    return utility::parallel_line_reduce(stream, Answers{}, get_calibration_values, utility::PairPlus{});
+}
+
+Answer get_line_term_part1(std::string_view line)
+{
+    return get_calibration_value(line, extract_digit);
+}
+
+Answer get_line_term_part2(std::string_view line)
+{
+    return get_calibration_value(line, extract_digit_or_word);
 }
-} // namespace task
+} // namespace task::day01
 
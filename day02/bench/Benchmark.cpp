@@ -0,0 +1,60 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Scanner.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using bench::solve;
+using task::detail::find_max_quantities;
+
+constexpr std::string_view example{R"(Game 1: 3 blue, 4 red; 1 red, 2 green, 6 blue; 2 green
+Game 2: 1 blue, 2 green; 3 green, 4 blue, 1 red; 1 green, 1 blue
+Game 3: 8 green, 6 blue, 20 red; 5 blue, 4 red, 13 green; 5 green, 1 red
+Game 4: 1 green, 3 red, 6 blue; 3 green, 6 red; 3 green, 15 blue, 14 red
+Game 5: 6 red, 1 blue, 3 green; 2 blue, 1 red, 2 green)"};
+
+void parse_game(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        for (const auto line : stream)
+        {
+            benchmark::DoNotOptimize(utility::scan<"Game {u}: {s}">(line));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+
+void find_max_quantities(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    std::vector<std::string_view> draws;
+    utility::Stream stream{input};
+    for (const auto line : stream)
+    {
+        draws.push_back(std::get<1>(utility::scan<"Game {u}: {s}">(line)));
+    }
+    for (auto _ : state)
+    {
+        for (const auto game_draws : draws)
+        {
+            benchmark::DoNotOptimize(find_max_quantities(game_draws));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_game)->Arg(1)->Arg(1000);
+BENCHMARK(find_max_quantities)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,48 @@
+#include "gen/Generator.hpp"
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+namespace
+{
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    std::array<std::string_view, 3> colors{"red", "green", "blue"};
+    const auto game_count = gen::scaled(scale, 100);
+    for (auto game = 1ull; game <= game_count; ++game)
+    {
+        if (game > 1)
+        {
+            output.put('\n');
+        }
+        output.write("Game ");
+        output.write_number(game);
+        output.write(": ");
+        const auto draw_count = gen::uniform(random, 1, 6);
+        for (auto draw = 0ull; draw < draw_count; ++draw)
+        {
+            if (draw > 0)
+            {
+                output.write("; ");
+            }
+            std::ranges::shuffle(colors, random);
+            const auto color_count = gen::uniform(random, 1, colors.size());
+            for (auto color = 0ull; color < color_count; ++color)
+            {
+                if (color > 0)
+                {
+                    output.write(", ");
+                }
+                output.write_number(gen::uniform(random, 1, 20));
+                output.put(' ');
+                output.write(colors[color]);
+            }
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string_view>
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day02::detail
+{
+struct Cubes
+{
+    unsigned long red, green, blue;
+};
+
+Cubes find_max_quantities(std::string_view draws);
+} // namespace task::day02::detail
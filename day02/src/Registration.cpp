@@ -0,0 +1,10 @@
+#include "Task.hpp"
+#include "utility/Registry.hpp"
+
+namespace
+{
+const utility::SolverRegistration part1{2, 1, task::solve_part1};
+const utility::SolverRegistration part2{2, 2, task::solve_part2};
+const utility::LineTermRegistration part1_line_term{2, 1, task::get_line_term_part1};
+const utility::LineTermRegistration part2_line_term{2, 2, task::get_line_term_part2};
+} // namespace
@@ -1,76 +1,106 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/Scanner.hpp"
 #include "utility/Stream.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Timer.hpp"
 #include <algorithm>
-#include <ranges>
-#include <regex>
+#include <string_view>
 
-namespace
+namespace task::inline day02::detail
 {
-auto parse_game_id(const std::string& string)
+struct Game
 {
-    const std::regex regex{R"((Game )(\d+)(: )(.*))"};
-    std::smatch result;
-    std::regex_search(string, result, regex);
-    return std::stoul(result.str(2));
-}
+    unsigned long id;
+    Cubes largest;
+};
 
-auto find_max_quantity(const std::string& string, std::string_view color)
+Cubes find_max_quantities(std::string_view draws)
 {
-    const std::regex regex{std::string{R"((\d+) )"}.append(color)};
-    std::sregex_iterator results_begin{string.begin(), string.end(), regex};
-    std::sregex_iterator results_end{};
-    auto max = 0ul;
-    std::for_each(results_begin, results_end, [&max](const auto& result) {
-        max = std::max(max, std::stoul(result.str(1)));
-    });
-    return max;
+    Cubes cubes{0, 0, 0};
+    while (not draws.empty())
+    {
+        const auto separator_pos = std::min(draws.find_first_of(",;"), draws.size());
+        const auto [quantity, color] = utility::scan<" {u} {s}">(draws.substr(0, separator_pos));
+        if (color == "red")
+        {
+            cubes.red = std::max(cubes.red, quantity);
+        }
+        else if (color == "green")
+        {
+            cubes.green = std::max(cubes.green, quantity);
+        }
+        else if (color == "blue")
+        {
+            cubes.blue = std::max(cubes.blue, quantity);
+        }
+        draws.remove_prefix(std::min(separator_pos + 1, draws.size()));
+    }
+    return cubes;
 }
 
-struct Cubes
-{
-    unsigned long red, green, blue;
-};
-auto find_max_quantities(const std::string& string)
+auto parse_game(std::string_view line)
 {
-    Cubes cubes;
-    cubes.red = find_max_quantity(string, "red");
-    cubes.green = find_max_quantity(string, "green");
-    cubes.blue = find_max_quantity(string, "blue");
-    return cubes;
+    TIME_SCOPE("parse_game");
+    const auto [id, draws] = utility::scan<"Game {u}: {s}">(line);
+    return Game{id, find_max_quantities(draws)};
 }
-} // namespace 
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+auto get_possible_game_id(const Game& game)
 {
     constexpr auto max_red = 12ul;
     constexpr auto max_green = 13ul;
     constexpr auto max_blue = 14ul;
-    auto sum = 0ul;
-    for (const auto& line : stream)
+    const auto& largest = game.largest;
+    if (largest.red <= max_red and largest.green <= max_green and largest.blue <= max_blue)
     {
-        auto game_id = parse_game_id(line);
-        const auto largest = find_max_quantities(line);
-        if (largest.red <= max_red and largest.green <= max_green and largest.blue <= max_blue)
-        {
-            sum += game_id;
-        }
+        return game.id;
     }
-    return sum;
+    return 0ul;
+}
+
+auto get_power(const Game& game)
+{
+    const auto& largest = game.largest;
+    return largest.red * largest.green * largest.blue;
+}
+} // namespace task::day02::detail
+
+namespace task::inline day02
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    TIME_SCOPE("sum_game_ids");
+    return utility::parallel_line_reduce(stream, 0ul, get_line_term_part1);
 }
 
 Answer solve_part2(utility::Stream& stream)
 {
-    auto sum = 0ul;
-    for (const auto& line : stream)
-    {
-        const auto largest = find_max_quantities(line);
-        const auto power = largest.red * largest.green * largest.blue;
-        sum += power;
-    }
-    return sum;
+    TIME_SCOPE("sum_powers");
+    return utility::parallel_line_reduce(stream, 0ul, get_line_term_part2);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    TIME_SCOPE("sum_game_ids_and_powers");
+    const auto get_line_terms = [](std::string_view line) {
+        const auto game = parse_game(line);
+        return Answers{get_possible_game_id(game), get_power(game)};
+    };
+    return utility::parallel_line_reduce(stream, Answers{}, get_line_terms, utility::PairPlus{});
+}
+
+Answer get_line_term_part1(std::string_view line)
+{
+    return get_possible_game_id(parse_game(line));
+}
+
+Answer get_line_term_part2(std::string_view line)
+{
+    return get_power(parse_game(line));
 }
-} // namespace task
+} // namespace task::day02
 
@@ -0,0 +1,79 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::find_adjacent_integers;
+using task::detail::is_part_symbol;
+using task::detail::parse_map;
+using task::detail::parse_numbers;
+
+constexpr std::string_view example{R"(467..114..
+...*......
+..35..633.
+......#...
+617*......
+.....+.58.
+..592.....
+......755.
+...$.*....
+.664.598..)"};
+
+void parse_map(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(parse_map(stream));
+    }
+    bench::set_throughput(state, input);
+}
+
+void parse_numbers(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Stream stream{input};
+    const auto map = parse_map(stream);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parse_numbers(map));
+    }
+    bench::set_throughput(state, input);
+}
+
+void find_adjacent_integers(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Stream stream{input};
+    const auto map = parse_map(stream);
+    const auto numbers = parse_numbers(map);
+    for (auto _ : state)
+    {
+        for (auto y = 0; y < map.get_height(); ++y)
+        {
+            for (auto x = 0; x < map.get_width(); ++x)
+            {
+                const auto position = map.to_index(x, y);
+                if (is_part_symbol(map[position]))
+                {
+                    benchmark::DoNotOptimize(find_adjacent_integers(numbers, position));
+                }
+            }
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_map)->Arg(1)->Arg(1000);
+BENCHMARK(parse_numbers)->Arg(1)->Arg(1000);
+BENCHMARK(find_adjacent_integers)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
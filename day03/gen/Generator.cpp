@@ -0,0 +1,41 @@
+#include "gen/Generator.hpp"
+#include <string_view>
+
+namespace
+{
+// Square schematic whose area grows with the scale, with numbers of up to 3 digits and scattered symbols.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr std::string_view symbols{"*#+$/@=%&-"};
+    const auto side = gen::scaled_side(scale, 140);
+    for (auto y = 0ull; y < side; ++y)
+    {
+        if (y > 0)
+        {
+            output.put('\n');
+        }
+        auto x = 0ull;
+        while (x < side)
+        {
+            if (const auto length = gen::uniform(random, 1, 3); x + length < side and gen::chance(random, 0.15))
+            {
+                output.put(static_cast<char>('0' + gen::uniform(random, 1, 9)));
+                for (auto i = 1ull; i < length; ++i)
+                {
+                    output.put(static_cast<char>('0' + gen::uniform(random, 0, 9)));
+                }
+                output.put('.');
+                x += length + 1;
+                continue;
+            }
+            output.put(gen::chance(random, 0.04) ? gen::pick(random, symbols) : '.');
+            ++x;
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <utility>
+
 #include "utility/Stream.hpp"
 
-namespace task
+namespace task::inline day03
 {
 using Answer = unsigned;
+using Answers = std::pair<Answer, Answer>;
 Answer solve_part1(utility::Stream&);
 
 Answer solve_part2(utility::Stream&);
-} // namespace task
+
+// Answers of both parts from a single parse of the input.
+Answers solve_both(utility::Stream&);
+} // namespace task::day03
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "utility/Grid.hpp"
+#include <vector>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day03::detail
+{
+using Map = utility::Grid<char>;
+
+using Integer = unsigned long;
+using Integers = std::vector<Integer>;
+
+using NumberId = int;
+using NumberIdMap = utility::Grid<NumberId>;
+
+struct Numbers
+{
+    Integers values;
+    NumberIdMap id_map;
+};
+
+Map parse_map(utility::Stream&);
+
+Numbers parse_numbers(const Map&);
+
+Integers find_adjacent_integers(const Numbers&, Map::Index position);
+
+bool is_part_symbol(char);
+} // namespace task::day03::detail
@@ -1,184 +1,115 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Grid.hpp"
+#include "utility/Parallel.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <numeric>
-#include <string>
 #include <vector>
-#include <optional>
 
-namespace
+namespace task::inline day03::detail
 {
-using Map = std::vector<std::string>;
-auto parse_map(utility::Stream& stream)
-{
-    Map map;
-    for (auto line : stream)
-    {
-        map.push_back(std::move(line));
-    }
-    return map;
-}
+constexpr auto empty_symbol = '.';
 
-struct Vector
+Map parse_map(utility::Stream& stream)
 {
-    int x, y;
-};
-auto get_size(const Map& map)
-{
-    if (map.empty())
-    {
-        return Vector{0, 0};
-    }
-    const auto y = static_cast<int>(map.size());
-    const auto x = static_cast<int>(map.front().length());
-    return Vector{x, y};
+    TIME_SCOPE("parse_map");
+    constexpr auto padding = 1;
+    return utility::parse_grid(stream, empty_symbol, padding);
 }
 
-struct Number
-{
-    std::string value;
-    int y, x_begin, x_end;
-};
-using Numbers = std::vector<Number>;
+constexpr auto no_number = NumberId{-1};
 
-class NumberCreator
+Numbers parse_numbers(const Map& map)
 {
-public:
-    void add_digit(char digit, int x, int y)
-    {
-        if (not number.has_value())
-        {
-            number = Number{};
-            number->y = y;
-            number->x_begin = x;
-            number->x_end = x;
-        }
-        number->value += digit;
-        number->x_end += 1;
-    }
-
-    std::optional<Number> finish()
-    {
-        std::optional<Number> result;
-        number.swap(result);
-        return result;
-    }
-
-private:
-    std::optional<Number> number;
-};
-
-auto parse_numbers(const Map& map)
-{
-    Numbers numbers;
-    const auto add_number = [&](const auto& opt_number) {
-        if (opt_number.has_value())
-        {
-            numbers.push_back(*opt_number);
-        }
+    TIME_SCOPE("parse_numbers");
+    Numbers numbers{
+        Integers{},
+        NumberIdMap{map.get_width(), map.get_height(), no_number, map.get_padding()},
     };
-    NumberCreator number_creator{};
-    const auto map_size = get_size(map);
-    for (auto y = 0; y < map_size.y; ++y)
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        for (auto x = 0; x < map_size.x; ++x)
+        const auto row = map.get_row(y);
+        auto x = 0;
+        while (x < map.get_width())
         {
-            const auto c = map[y][x];
-            if (std::isdigit(c))
+            if (not std::isdigit(row[x]))
             {
-                number_creator.add_digit(c, x, y);
+                ++x;
+                continue;
             }
-            else
+            const auto id = static_cast<NumberId>(numbers.values.size());
+            Integer value{0};
+            for (; x < map.get_width() and std::isdigit(row[x]); ++x)
             {
-                auto current_number = number_creator.finish();
-                add_number(current_number);
+                value = 10 * value + static_cast<Integer>(row[x] - '0');
+                numbers.id_map.at(x, y) = id;
             }
+            numbers.values.push_back(value);
         }
-        auto current_number = number_creator.finish();
-        add_number(current_number);
     }
     return numbers;
 }
 
-auto is_adjacent(const Vector origin, const Vector query)
-{
-    const auto diff_x = origin.x - query.x;
-    const auto diff_y = origin.y - query.y;
-    return std::abs(diff_x) <= 1 and std::abs(diff_y) <= 1;
-}
-
-auto is_adjacent(const Number& number, const Vector query)
+Integers find_adjacent_integers(const Numbers& numbers, const Map::Index position)
 {
-    for (auto x = number.x_begin; x < number.x_end; ++x)
+    std::array<NumberId, 8> adjacent_ids;
+    auto adjacent_end = adjacent_ids.begin();
+    for (const auto offset : numbers.id_map.get_neighbour_offsets())
     {
-        const Vector position{x, number.y};
-        if (is_adjacent(position, query))
+        if (const auto id = numbers.id_map[position + offset]; id != no_number)
         {
-            return true;
+            *adjacent_end++ = id;
         }
     }
-    return false;
-}
+    std::sort(adjacent_ids.begin(), adjacent_end);
+    adjacent_end = std::unique(adjacent_ids.begin(), adjacent_end);
 
-using Integers = std::vector<unsigned long>;
-Integers find_adjacent_integers(const Numbers& numbers, const Vector position)
-{
     Integers result;
-    for (const auto& number : numbers)
+    for (auto itr = adjacent_ids.begin(); itr != adjacent_end; ++itr)
     {
-        if (is_adjacent(number, position))
-        {
-            result.push_back(std::stoul(number.value));
-        }
+        result.push_back(numbers.values[static_cast<std::size_t>(*itr)]);
     }
     return result;
 }
 
-auto is_part_symbol(char c)
+bool is_part_symbol(char c)
 {
-    return not std::isdigit(c) and c != '.';
+    return not std::isdigit(c) and c != empty_symbol;
 }
-} // namespace
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+auto sum_part_numbers(const Map& map, const Numbers& numbers)
 {
-    const auto map = parse_map(stream);
-    const auto numbers = parse_numbers(map);
-
     auto sum = 0ull;
-    const auto map_size = get_size(map);
-    for (auto y = 0; y < map_size.y; ++y)
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        for (auto x = 0; x < map_size.x; ++x)
+        for (auto x = 0; x < map.get_width(); ++x)
         {
-            const auto c = map[y][x];
-            if (is_part_symbol(c))
+            const auto position = map.to_index(x, y);
+            if (is_part_symbol(map[position]))
             {
-                const auto adjacent_numbers = find_adjacent_integers(numbers, Vector{x, y});
+                const auto adjacent_numbers = find_adjacent_integers(numbers, position);
                 sum += std::accumulate(adjacent_numbers.begin(), adjacent_numbers.end(), 0);
             }
         }
     }
-
     return sum;
 }
 
-Answer solve_part2(utility::Stream& stream)
+auto sum_gear_ratios(const Map& map, const Numbers& numbers)
 {
-    const auto map = parse_map(stream);
-    const auto numbers = parse_numbers(map);
-
     auto sum = 0ull;
-    const auto map_size = get_size(map);
-    for (auto y = 0; y < map_size.y; ++y)
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        for (auto x = 0; x < map_size.x; ++x)
+        for (auto x = 0; x < map.get_width(); ++x)
         {
-            const auto c = map[y][x];
-            if (c == '*')
+            const auto position = map.to_index(x, y);
+            if (map[position] == '*')
             {
-                const auto adjacent_numbers = find_adjacent_integers(numbers, Vector{x, y});
+                const auto adjacent_numbers = find_adjacent_integers(numbers, position);
                 if (adjacent_numbers.size() != 2u)
                 {
                     continue;
@@ -187,7 +118,34 @@ Answer solve_part2(utility::Stream& stream)
             }
         }
     }
-
     return sum;
 }
-} // namespace task
+} // namespace task::day03::detail
+
+namespace task::inline day03
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    const auto map = parse_map(stream);
+    const auto numbers = parse_numbers(map);
+    return sum_part_numbers(map, numbers);
+}
+
+Answer solve_part2(utility::Stream& stream)
+{
+    const auto map = parse_map(stream);
+    const auto numbers = parse_numbers(map);
+    return sum_gear_ratios(map, numbers);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    const auto map = parse_map(stream);
+    const auto numbers = parse_numbers(map);
+    return utility::run_concurrently(
+        [&map, &numbers]() -> Answer { return sum_part_numbers(map, numbers); },
+        [&map, &numbers]() -> Answer { return sum_gear_ratios(map, numbers); });
+}
+} // namespace task::day03
@@ -0,0 +1,66 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Arena.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using bench::solve;
+using task::detail::Card;
+using task::detail::count_matching_numbers;
+using task::detail::parse_card;
+
+constexpr std::string_view example{R"(Card 1: 41 48 83 86 17 | 83 86  6 31 17  9 48 53
+Card 2: 13 32 20 16 61 | 61 30 68 82 17 32 24 19
+Card 3:  1 21 53 59 44 | 69 82 63 72 16 21 14  1
+Card 4: 41 92 73 84 69 | 59 84 76 51 58  5 54 83
+Card 5: 87 83 26 28 32 | 88 30 70 12 93 22 82 36
+Card 6: 31 18 13 56 72 | 74 77 10 23 35 67 36 11)"};
+
+void parse_card(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        for (const auto line : stream)
+        {
+            benchmark::DoNotOptimize(parse_card(line));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+
+void count_matching_numbers(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    std::vector<Card> cards;
+    utility::Stream stream{input};
+    for (const auto line : stream)
+    {
+        cards.push_back(parse_card(line));
+    }
+    for (auto _ : state)
+    {
+        for (const auto& card : cards)
+        {
+            benchmark::DoNotOptimize(count_matching_numbers(card));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_card)->Arg(1)->Arg(1000);
+BENCHMARK(count_matching_numbers)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
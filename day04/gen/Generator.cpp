@@ -0,0 +1,57 @@
+#include "gen/Generator.hpp"
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Cards with 10 and 25 distinct numbers. Only every fifth card has matching numbers, at most 4 of them, so that the
+// number of copies in part 2 stays small at any scale.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr auto own_count = 10u;
+    constexpr auto winning_count = 25u;
+    constexpr auto max_matching_count = 4u;
+    std::vector<unsigned> numbers(99);
+    std::iota(numbers.begin(), numbers.end(), 1u);
+
+    const auto card_count = gen::scaled(scale, 200);
+    const auto id_width = std::to_string(card_count).size();
+    for (auto card = 1ull; card <= card_count; ++card)
+    {
+        if (card > 1)
+        {
+            output.put('\n');
+        }
+        std::ranges::shuffle(numbers, random);
+        const auto own_numbers = std::span{numbers}.first(own_count);
+        std::vector<unsigned> winning_numbers(numbers.begin() + own_count, numbers.begin() + own_count + winning_count);
+        const auto remaining_count = card_count - card;
+        const auto matching_count = card % 5 == 0
+            ? std::min<std::uint64_t>(gen::uniform(random, 0, max_matching_count), remaining_count)
+            : 0;
+        std::copy_n(own_numbers.begin(), matching_count, winning_numbers.begin());
+        std::ranges::shuffle(winning_numbers, random);
+
+        output.write("Card ");
+        output.write_number(card, id_width);
+        output.put(':');
+        for (const auto number : own_numbers)
+        {
+            output.write_number(number, 3);
+        }
+        output.write(" |");
+        for (const auto number : winning_numbers)
+        {
+            output.write_number(number, 3);
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
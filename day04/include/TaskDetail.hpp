@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <set>
+#include <string_view>
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day04::detail
+{
+using Number = unsigned long;
+using Numbers = std::pmr::set<Number>;
+struct Card
+{
+    using Id = unsigned long;
+    Id id;
+    Numbers own_numbers;
+    Numbers winning_numbers;
+};
+
+// Numbers are allocated from the current arena.
+Card parse_card(std::string_view);
+
+std::size_t count_matching_numbers(const Card&);
+} // namespace task::day04::detail
@@ -0,0 +1,9 @@
+#include "Task.hpp"
+#include "utility/Registry.hpp"
+
+namespace
+{
+const utility::SolverRegistration part1{4, 1, task::solve_part1};
+const utility::SolverRegistration part2{4, 2, task::solve_part2};
+const utility::LineTermRegistration part1_line_term{4, 1, task::get_line_term_part1};
+} // namespace
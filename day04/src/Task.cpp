@@ -1,52 +1,42 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Arena.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/Scanner.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
+#include "utility/Tokenizer.hpp"
 #include <algorithm>
 #include <iterator>
 #include <ranges>
-#include <regex>
+#include <map>
 #include <set>
+#include <string_view>
 #include <vector>
 
-namespace
+namespace task::inline day04::detail
 {
-using Number = unsigned long;
-using Numbers = std::set<Number>;
-struct Card
+auto parse_numbers(const utility::Integers<Number>& integers)
 {
-    using Id = unsigned long;
-    Id id;
-    Numbers own_numbers;
-    Numbers winning_numbers;
-};
-
-auto parse_numbers(const std::string& string)
-{
-    Numbers numbers;
-    const std::regex number_regex{R"(\b\d+?\b)"};
-    const std::sregex_iterator numbers_begin{string.begin(), string.end(), number_regex};
-    const std::sregex_iterator numbers_end{};
-    for (auto number_itr = numbers_begin; number_itr != numbers_end; ++number_itr)
+    Numbers numbers{utility::get_current_resource()};
+    for (const auto number : integers)
     {
-        numbers.insert(std::stoul(number_itr->str()));
+        numbers.insert(number);
     }
     return numbers;
 }
 
-auto parse_card(const std::string& string)
+Card parse_card(std::string_view string)
 {
-    const std::regex regex{R"((Card +)(\d+)(: )(.*?)( \| )(.*))"};
-    std::smatch result;
-    std::regex_search(string, result, regex);
-    Card card;
-    card.id = std::stoul(result.str(2));
-    card.own_numbers = parse_numbers(result.str(4));
-    card.winning_numbers = parse_numbers(result.str(6));
-    return card;
+    TIME_SCOPE("parse_card");
+    const auto [id, own_numbers, winning_numbers] = utility::scan<"Card {u}: {list} | {list}">(string);
+    return Card{id, parse_numbers(own_numbers), parse_numbers(winning_numbers)};
 }
 
-auto count_matching_numbers(const Card& card)
+std::size_t count_matching_numbers(const Card& card)
 {
-    std::vector<Number> matching_numbers;
+    TIME_SCOPE("count_matching_numbers");
+    std::pmr::vector<Number> matching_numbers{utility::get_current_resource()};
     std::set_intersection(
         card.winning_numbers.begin(),
         card.winning_numbers.end(),
@@ -55,53 +45,95 @@ auto count_matching_numbers(const Card& card)
         std::back_inserter(matching_numbers));
     return matching_numbers.size();
 }
-} // namespace 
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+auto get_points(std::size_t count_of_matching_numbers)
 {
-    auto sum = 0ull;
-    for (const auto& line : stream)
+    if (count_of_matching_numbers > 0)
     {
-        const auto card = parse_card(line);
-        const auto count_of_matching_numbers = count_matching_numbers(card);
-        if (count_of_matching_numbers > 0)
-        {
-            const auto double_count = count_of_matching_numbers - 1;
-            sum += 1 << double_count;
-        }
+        const auto double_count = count_of_matching_numbers - 1;
+        return 1ul << double_count;
     }
-    return sum;
+    return 0ul;
+}
+} // namespace task::day04::detail
+
+namespace task::inline day04
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    TIME_SCOPE("sum_points");
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    return utility::parallel_line_reduce(stream, 0ul, get_line_term_part1);
+}
+
+Answer get_line_term_part1(std::string_view line)
+{
+    const auto card = parse_card(line);
+    return get_points(count_matching_numbers(card));
 }
 
 namespace 
 {
 using CopyCount = unsigned;
-using CountMap = std::map<Card::Id, CopyCount>;
+using CountMap = std::pmr::map<Card::Id, CopyCount>;
+
+// Counts the original card, adds its copies to the cards it wins and returns the number of its copies.
+auto add_copies(CountMap& count_map, Card::Id id, std::size_t count_of_matching_numbers)
+{
+    const auto current_count = ++count_map[id];
+    const auto following_begin = id + 1;
+    const auto following_end = following_begin + count_of_matching_numbers;
+    for (const auto& next_id : std::views::iota(following_begin, following_end))
+    {
+        auto& next_count = count_map[next_id];
+        next_count += current_count;
+    }
+    return current_count;
+}
 } // namespace 
 
 Answer solve_part2(utility::Stream& stream)
 {
+    TIME_SCOPE("count_copies");
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
     auto sum = 0ull;
-    CountMap count_map;
+    CountMap count_map{utility::get_current_resource()};
     for (const auto& line : stream)
     {
+        if (line.empty())
+        {
+            continue;
+        }
         const auto card = parse_card(line);
-        auto& current_count = count_map[card.id];
-        ++current_count;
+        sum += add_copies(count_map, card.id, count_matching_numbers(card));
+    }
+    return sum;
+}
 
-        const auto count_of_matching_numbers = count_matching_numbers(card);
-        const auto following_begin = card.id + 1;
-        const auto following_end = following_begin + count_of_matching_numbers;
-        for (const auto& next_id : std::views::iota(following_begin, following_end))
+// Copies depend on the cards before them, so the cards are parsed in order and scored for both parts at once.
+Answers solve_both(utility::Stream& stream)
+{
+    TIME_SCOPE("sum_points_and_count_copies");
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    Answers answers{0, 0};
+    CountMap count_map{utility::get_current_resource()};
+    for (const auto& line : stream)
+    {
+        if (line.empty())
         {
-            auto& next_count = count_map[next_id];
-            next_count += current_count;
+            continue;
         }
-        sum += current_count;
+        const auto card = parse_card(line);
+        const auto count_of_matching_numbers = count_matching_numbers(card);
+        answers.first += get_points(count_of_matching_numbers);
+        answers.second += add_copies(count_map, card.id, count_of_matching_numbers);
     }
-    return sum;
+    return answers;
 }
-} // namespace task
+} // namespace task::day04
 
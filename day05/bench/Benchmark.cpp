@@ -0,0 +1,125 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Stream.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using task::detail::find_lowest_location;
+using task::detail::parse_maps;
+using task::detail::parse_seed_ranges;
+
+constexpr std::string_view example{R"(seeds: 79 14 55 13
+
+seed-to-soil map:
+50 98 2
+52 50 48
+
+soil-to-fertilizer map:
+0 15 37
+37 52 2
+39 0 15
+
+fertilizer-to-water map:
+49 53 8
+0 11 42
+42 0 7
+57 7 4
+
+water-to-light map:
+88 18 7
+18 25 70
+
+light-to-temperature map:
+45 77 23
+81 45 19
+68 64 13
+
+temperature-to-humidity map:
+0 69 1
+1 0 69
+
+humidity-to-location map:
+60 56 37
+56 93 4)"};
+
+// Almanac with `count` seed ranges and `count` mappings in each of its 7 maps, which shuffle the ranges around.
+std::string make_almanac(std::int64_t count)
+{
+    constexpr std::int64_t range_length{1000};
+    std::string almanac{"seeds:"};
+    for (std::int64_t index{0}; index < count; ++index)
+    {
+        almanac += CONCAT(" ", index * range_length + index % 7, " ", range_length / 2);
+    }
+    almanac += '\n';
+    constexpr auto num_of_maps = 7;
+    for (auto map_index = 0; map_index < num_of_maps; ++map_index)
+    {
+        almanac += CONCAT("\nmap ", map_index, ":\n");
+        for (std::int64_t index{0}; index < count; ++index)
+        {
+            const auto destination = ((index * 7919 + map_index) % count) * range_length + 100;
+            almanac += CONCAT(destination, " ", index * range_length, " ", range_length - 200, "\n");
+        }
+    }
+    almanac.pop_back();
+    return almanac;
+}
+
+// The first argument of 1 selects the puzzle example, larger ones a generated almanac of that size.
+std::string get_almanac(const benchmark::State& state)
+{
+    const auto count = state.range(0);
+    return count == 1 ? std::string{example} : make_almanac(count);
+}
+
+void parse_almanac(benchmark::State& state)
+{
+    const auto input = get_almanac(state);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(parse_seed_ranges(stream.next_line()));
+        stream.skip();
+        benchmark::DoNotOptimize(parse_maps(stream));
+    }
+    bench::set_throughput(state, input);
+}
+
+void find_lowest_location(benchmark::State& state)
+{
+    const auto input = get_almanac(state);
+    utility::Stream stream{input};
+    const auto seed_ranges = parse_seed_ranges(stream.next_line());
+    stream.skip();
+    const auto maps = parse_maps(stream);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(find_lowest_location(seed_ranges, maps));
+    }
+    bench::set_throughput(state, input);
+}
+
+void solve(benchmark::State& state, task::Answer (*solve_part)(utility::Stream&))
+{
+    const auto input = get_almanac(state);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(solve_part(stream));
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_almanac)->Arg(1)->Arg(100);
+BENCHMARK(find_lowest_location)->Arg(1)->Arg(100);
+BENCHMARK_CAPTURE(solve, part1, task::solve_part1)->Arg(1)->Arg(100)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, task::solve_part2)->Arg(1)->Arg(100)->UseRealTime();
+
+BENCHMARK_MAIN();
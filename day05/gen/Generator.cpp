@@ -0,0 +1,62 @@
+#include "gen/Generator.hpp"
+#include <array>
+#include <string_view>
+
+namespace
+{
+constexpr auto max_value = 4'000'000'000ull;
+
+// Map splitting the values into contiguous source ranges, each of them shifted to a random destination.
+void generate_map(gen::Output& output, gen::Random& random, std::string_view name, std::uint64_t range_count)
+{
+    output.write(name);
+    output.write(" map:");
+    const auto max_length = 2 * max_value / range_count;
+    auto source = gen::uniform(random, 0, max_length);
+    for (auto range = 0ull; range < range_count and source < max_value; ++range)
+    {
+        const auto length = gen::uniform(random, 1, max_length);
+        output.put('\n');
+        output.write_number(gen::uniform(random, 0, max_value));
+        output.put(' ');
+        output.write_number(source);
+        output.put(' ');
+        output.write_number(length);
+        source += length;
+    }
+}
+
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    output.write("seeds:");
+    const auto seed_range_count = gen::scaled(scale, 10);
+    for (auto range = 0ull; range < seed_range_count; ++range)
+    {
+        output.put(' ');
+        output.write_number(gen::uniform(random, 0, max_value));
+        output.put(' ');
+        output.write_number(gen::uniform(random, 1, max_value / 10));
+    }
+
+    constexpr std::array<std::string_view, 7> map_names{
+        "seed-to-soil",
+        "soil-to-fertilizer",
+        "fertilizer-to-water",
+        "water-to-light",
+        "light-to-temperature",
+        "temperature-to-humidity",
+        "humidity-to-location",
+    };
+    const auto range_count = gen::scaled(scale, 30);
+    for (const auto name : map_names)
+    {
+        output.write("\n\n");
+        generate_map(output, random, name, range_count);
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
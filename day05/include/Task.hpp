@@ -1,14 +1,20 @@
 #pragma once
 
+#include <utility>
+
 namespace utility
 {
 class Stream;
 } // namespace utility
 
-namespace task
+namespace task::inline day05
 {
 using Answer = unsigned long;
+using Answers = std::pair<Answer, Answer>;
 Answer solve_part1(utility::Stream&);
 
 Answer solve_part2(utility::Stream&);
-} // namespace task
+
+// Answers of both parts from a single parse of the input.
+Answers solve_both(utility::Stream&);
+} // namespace task::day05
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <string_view>
+#include <vector>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day05::detail
+{
+using Value = long long;
+
+struct Range
+{
+    Value first, last;
+};
+bool operator<(const Range& lhs, const Range& rhs);
+using Ranges = std::pmr::set<Range>;
+
+using Start = Value;
+using Shift = Value;
+using Map = std::pmr::map<Start, Shift>;
+using Maps = std::pmr::vector<Map>;
+
+// Ranges and maps are allocated from the current arena.
+Ranges parse_seed_ranges(std::string_view);
+
+Maps parse_maps(utility::Stream&);
+
+Value find_lowest_location(const Ranges&, const Maps&);
+} // namespace task::day05::detail
@@ -1,78 +1,70 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Arena.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/ParseCache.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
+#include "utility/Tokenizer.hpp"
+#include <cstdint>
 #include <limits>
 #include <map>
-#include <regex>
 #include <set>
+#include <stdexcept>
+#include <string_view>
 #include <vector>
 
-namespace
+namespace task::inline day05::detail
 {
-using Value = long long;
-
-struct Range
-{
-    Value first, last;
-};
 bool operator<(const Range& lhs, const Range& rhs)
 {
     return lhs.first < rhs.first;
 }
-using Ranges = std::set<Range>;
-
-auto parse_seeds(const std::string& string)
-{
-    const std::regex regex{R"(seeds: (.*))"};
-    std::smatch result;
-    std::regex_search(string, result, regex);
-    return result.str();
-}
-
-auto parse_seed_values(const std::string& string)
+auto parse_seed_values(std::string_view string)
 {
-    const auto seeds_str = parse_seeds(string);
-
-    const std::regex value_regex{R"(\d+)"};
-    const std::sregex_iterator values_begin{seeds_str.begin(), seeds_str.end(), value_regex};
-    const std::sregex_iterator values_end{};
-    Ranges seeds;
-    for (auto value_itr = values_begin; value_itr != values_end; ++value_itr)
+    TIME_SCOPE("parse_seed_values");
+    Ranges seeds{utility::get_current_resource()};
+    for (const auto value : utility::Integers<Value>{string})
     {
-        const auto value = std::stoll(value_itr->str());
         const auto length = Value{1};
         seeds.insert(Range{value, length});
     }
     return seeds;
 }
 
-auto parse_seed_ranges(const std::string& string)
+Ranges parse_seed_ranges(std::string_view string)
 {
-    const auto seeds_str = parse_seeds(string);
-
-    const std::regex pair_regex{R"((\d+) (\d+))"};
-    const std::sregex_iterator pairs_begin{seeds_str.begin(), seeds_str.end(), pair_regex};
-    const std::sregex_iterator pairs_end{};
-    Ranges ranges;
-    for (auto pair_itr = pairs_begin; pair_itr != pairs_end; ++pair_itr)
+    TIME_SCOPE("parse_seed_ranges");
+    const utility::Integers<Value> values{string};
+    Ranges ranges{utility::get_current_resource()};
+    for (auto value_itr = values.begin(); value_itr != values.end(); ++value_itr)
     {
-        const auto range_first = std::stoll(pair_itr->str(1));
-        const auto range_length = std::stoll(pair_itr->str(2));
+        const auto range_first = *value_itr;
+        if (++value_itr == values.end())
+        {
+            break;
+        }
+        const auto range_length = *value_itr;
+        if (range_length < 0)
+        {
+            throw std::invalid_argument{CONCAT("Seed range of negative length ", range_length)};
+        }
+        // A range without seeds has no last seed to store.
+        if (range_length == 0)
+        {
+            continue;
+        }
         const auto range_last = range_first + (range_length - 1);
         ranges.insert(Range{range_first, range_last});
     }
     return ranges;
 }
 
-using Start = Value;
-using Shift = Value;
-using Map = std::map<Start, Shift>;
-using Maps = std::vector<Map>;
-
 auto parse_map(utility::Stream& stream)
 {
-    Map map{{Start{0}, Shift{0}}};
+    Map map{{{Start{0}, Shift{0}}}, utility::get_current_resource()};
     stream.skip();
-    const std::regex mapping_regex{R"((\d+) (\d+) (\d+))"};
     while (stream.is_active())
     {
         const auto line = stream.next_line();
@@ -80,15 +72,10 @@ auto parse_map(utility::Stream& stream)
         {
             break;
         }
-        std::smatch result;
-        std::regex_search(line, result, mapping_regex);
-
-        const auto start = std::stoll(result.str(2));
-        const auto destination_start = std::stoll(result.str(1));
+        const auto [destination_start, start, length] = utility::parse_integers<Value, 3>(line);
         const auto shift = destination_start - start;
         map.insert_or_assign(start, shift);
 
-        const auto length = std::stoll(result.str(3));
         const auto next_start = start + length;
         map.emplace(next_start, Shift{0});
     }
@@ -96,17 +83,67 @@ auto parse_map(utility::Stream& stream)
     return map;
 }
 
-auto parse_maps(utility::Stream& stream)
+// Maps are cached as the number of shifts of each map followed by the shifts of all maps.
+struct CachedShift
 {
-    Maps maps;
-    while (stream.is_active())
+    Start start;
+    Shift shift;
+};
+constexpr utility::ParseCacheKey maps_cache_key{"day05-maps", 1};
+
+void save_maps(utility::ParseCacheWriter& writer, const Maps& maps)
+{
+    std::vector<std::uint64_t> sizes;
+    std::vector<CachedShift> shifts;
+    for (const auto& map : maps)
+    {
+        sizes.push_back(map.size());
+        for (const auto& [start, shift] : map)
+        {
+            shifts.push_back(CachedShift{start, shift});
+        }
+    }
+    writer.write_array<std::uint64_t>(sizes);
+    writer.write_array<CachedShift>(shifts);
+}
+
+auto load_maps(utility::ParseCacheReader& reader)
+{
+    const auto sizes = reader.read_array<std::uint64_t>();
+    auto shifts = reader.read_array<CachedShift>();
+    Maps maps{utility::get_current_resource()};
+    maps.reserve(sizes.size());
+    for (const auto size : sizes)
     {
-        auto map = parse_map(stream);
-        maps.push_back(std::move(map));
+        if (size > shifts.size())
+        {
+            throw std::logic_error{"Parse cache is corrupted: maps exceed their shifts"};
+        }
+        auto& map = maps.emplace_back();
+        for (const auto& [start, shift] : shifts.first(size))
+        {
+            map.emplace_hint(map.end(), start, shift);
+        }
+        shifts = shifts.subspan(size);
     }
     return maps;
 }
 
+Maps parse_maps(utility::Stream& stream)
+{
+    TIME_SCOPE("parse_maps");
+    const auto parse = [](utility::Stream& stream) {
+        Maps maps{utility::get_current_resource()};
+        while (stream.is_active())
+        {
+            auto map = parse_map(stream);
+            maps.push_back(std::move(map));
+        }
+        return maps;
+    };
+    return utility::parse_cached(stream, maps_cache_key, parse, save_maps, load_maps);
+}
+
 bool overlapping(const Range& r1, const Range& r2)
 {
     if (r1.first < r2.first)
@@ -136,7 +173,7 @@ constexpr auto infinity = std::numeric_limits<Value>::max();
 
 Ranges translate(const Ranges& ranges, const Map& map)
 {
-    Ranges result;
+    Ranges result{utility::get_current_resource()};
     for (const auto& range : ranges)
     {
         for (auto mapping_itr = map.cbegin(); mapping_itr != map.cend(); ++mapping_itr)
@@ -157,8 +194,16 @@ Ranges translate(const Ranges& ranges, const Map& map)
     return result;
 }
 
-auto find_lowest_location(Ranges ranges, const Maps& maps)
+Value find_lowest_location(const Ranges& seed_ranges, const Maps& maps)
 {
+    TIME_SCOPE("find_lowest_location");
+    if (seed_ranges.empty())
+    {
+        throw std::invalid_argument{"No seeds to locate"};
+    }
+    // The working set is given the current arena explicitly, as a copied set would use the default resource, and
+    // assigning the translated sets, which come from the arena, to it would then copy their nodes on every step.
+    Ranges ranges{seed_ranges, utility::get_current_resource()};
     for (const auto& map : maps)
     {
         ranges = translate(ranges, map);
@@ -167,12 +212,16 @@ auto find_lowest_location(Ranges ranges, const Maps& maps)
     const auto& lowest_range = *ranges.begin();
     return lowest_range.first;
 }
-} // namespace 
+} // namespace task::day05::detail
 
-namespace task
+namespace task::inline day05
 {
+using namespace detail;
+
 Answer solve_part1(utility::Stream& stream)
 {
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
     const auto seed_ranges = parse_seed_values(stream.next_line());
     stream.skip();
     const auto maps = parse_maps(stream);
@@ -182,11 +231,29 @@ Answer solve_part1(utility::Stream& stream)
 
 Answer solve_part2(utility::Stream& stream)
 {
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
     const auto seed_ranges = parse_seed_ranges(stream.next_line());
     stream.skip();
     auto maps = parse_maps(stream);
 
     return find_lowest_location(seed_ranges, maps);
 }
-} // namespace task
+
+Answers solve_both(utility::Stream& stream)
+{
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    const auto seeds_line = stream.next_line();
+    const auto seed_values = parse_seed_values(seeds_line);
+    const auto seed_ranges = parse_seed_ranges(seeds_line);
+    stream.skip();
+    const auto maps = parse_maps(stream);
+
+    // Both parts only read the shared seeds and maps, their own ranges are allocated from their own arenas.
+    return utility::run_concurrently(
+        [&seed_values, &maps]() -> Answer { return find_lowest_location(seed_values, maps); },
+        [&seed_ranges, &maps]() -> Answer { return find_lowest_location(seed_ranges, maps); });
+}
+} // namespace task::day05
 
@@ -0,0 +1,88 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::count_options;
+using task::detail::parse_races;
+using task::detail::parse_single_race;
+using task::detail::read_lines;
+
+constexpr std::string_view example{R"(Time:      7  15   30
+Distance:  9  40  200)"};
+
+// Example with its races repeated `count` times.
+std::string make_races(std::int64_t count)
+{
+    std::string times{"Time:"};
+    std::string distances{"Distance:"};
+    for (std::int64_t index{0}; index < count; ++index)
+    {
+        times.append("      7  15   30");
+        distances.append("  9  40  200");
+    }
+    return times + '\n' + distances;
+}
+
+void parse_races(benchmark::State& state)
+{
+    const auto input = make_races(state.range(0));
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(parse_races(read_lines(stream)));
+    }
+    bench::set_throughput(state, input);
+}
+
+void count_options(benchmark::State& state)
+{
+    const auto input = make_races(state.range(0));
+    utility::Stream stream{input};
+    const auto races = parse_races(read_lines(stream));
+    for (auto _ : state)
+    {
+        for (const auto& race : races)
+        {
+            benchmark::DoNotOptimize(count_options(race));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(races.size()));
+}
+
+void count_options_of_single_race(benchmark::State& state)
+{
+    utility::Stream stream{example};
+    const auto race = parse_single_race(read_lines(stream));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(count_options(race));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(race.time));
+}
+
+void solve_part1(benchmark::State& state)
+{
+    const auto input = make_races(state.range(0));
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(task::solve_part1(stream));
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_races)->Arg(1)->Arg(1000);
+BENCHMARK(count_options)->Arg(1)->Arg(1000);
+BENCHMARK(count_options_of_single_race);
+BENCHMARK(solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,36 @@
+#include "gen/Generator.hpp"
+#include <vector>
+
+namespace
+{
+// Races which can all be won. Part 2 joins the digits of all races into one number, so it only makes sense for
+// scales up to 1.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    const auto race_count = gen::scaled(scale, 4);
+    std::vector<std::uint64_t> times, distances;
+    for (auto race = 0ull; race < race_count; ++race)
+    {
+        const auto time = gen::uniform(random, 7, 99);
+        times.push_back(time);
+        distances.push_back(gen::uniform(random, time, time * time / 4 - 1));
+    }
+
+    constexpr auto width = 5u;
+    output.write("Time:    ");
+    for (const auto time : times)
+    {
+        output.write_number(time, width);
+    }
+    output.write("\nDistance:");
+    for (const auto distance : distances)
+    {
+        output.write_number(distance, width);
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day06::detail
+{
+using Time = unsigned long long;
+using Distance = unsigned long long;
+struct Race
+{
+    Time time;
+    Distance top_distance;
+};
+using Races = std::vector<Race>;
+
+struct Lines
+{
+    std::string time, distance;
+};
+
+Lines read_lines(utility::Stream&);
+
+Races parse_races(const Lines&);
+
+// Reads the numbers of each line as a single one, ignoring the spaces between their digits.
+Race parse_single_race(const Lines&);
+
+unsigned count_options(const Race&);
+} // namespace task::day06::detail
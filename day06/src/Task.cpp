@@ -1,63 +1,73 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
 #include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include "utility/Tokenizer.hpp"
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
-#include <regex>
 
-namespace
+namespace task::inline day06::detail
 {
-using Time = unsigned long long;
-using Distance = unsigned long long;
-struct Race
+using Numbers = std::vector<unsigned long long>;
+
+auto parse_numbers(std::string_view line)
+{
+    Numbers numbers;
+    for (const auto number : utility::Integers<Numbers::value_type>{line})
+    {
+        numbers.push_back(number);
+    }
+    return numbers;
+}
+
+Lines read_lines(utility::Stream& stream)
 {
-    Time time;
-    Distance top_distance;
-};
-using Races = std::vector<Race>;
+    std::string time{stream.next_line()};
+    std::string distance{stream.next_line()};
+    return Lines{std::move(time), std::move(distance)};
+}
 
-auto parse_races(utility::Stream& stream)
+Races parse_races(const Lines& lines)
 {
-    const std::regex numbers_regex{R"(( *)(\d+))"};
-    const auto time_line = stream.next_line();
-    std::sregex_iterator time_matches_itr{time_line.begin(), time_line.end(), numbers_regex};
-    const auto distance_line = stream.next_line();
-    std::sregex_iterator distance_matches_itr{distance_line.begin(), distance_line.end(), numbers_regex};
-    const std::sregex_iterator matches_end{};
-    
+    TIME_SCOPE("parse_races");
+    const auto times = parse_numbers(lines.time);
+    const auto distances = parse_numbers(lines.distance);
+
     Races races;
-    while (time_matches_itr != matches_end)
+    for (auto index = 0u; index < times.size() and index < distances.size(); ++index)
     {
-        const auto time = std::stoull(time_matches_itr->str(2));
-        const auto distance = std::stoull(distance_matches_itr->str(2));
-        races.push_back(Race{time, distance});
-        ++time_matches_itr;
-        ++distance_matches_itr;
+        races.push_back(Race{times[index], distances[index]});
     }
     return races;
 }
 
-auto count_options(const Race& race)
+unsigned count_options(const Race& race)
 {
-    auto num_of_options = 0u;
-    for (Time hold_time{0}; hold_time < race.time; ++hold_time)
-    {
+    TIME_SCOPE("count_options");
+    constexpr auto min_chunk_size = std::size_t{1 << 16};
+    const auto is_winning = [&race](std::size_t hold_time) {
         const auto speed = hold_time;
         const auto remaining_time = race.time - hold_time;
         const auto travelled_distance = speed * remaining_time;
-        if (travelled_distance > race.top_distance)
-        {
-            ++num_of_options;
-        }
-    }
-    return num_of_options;
+        return travelled_distance > race.top_distance ? 1u : 0u;
+    };
+    const auto& pool = utility::ThreadPool::get_default();
+    const auto chunk_size = std::max(min_chunk_size, utility::get_default_chunk_size(race.time, pool));
+    return utility::parallel_reduce(0, race.time, 0u, is_winning, std::plus<>{}, chunk_size);
 }
-} // namespace 
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+auto multiply_options(const Races& races)
 {
-    const auto races = parse_races(stream);
     auto result = 1;
     for (const auto& race : races)
     {
@@ -66,38 +76,61 @@ Answer solve_part1(utility::Stream& stream)
     }
     return result;
 }
+} // namespace task::day06::detail
 
-namespace
+namespace task::inline day06
 {
-auto parse_single_race(utility::Stream& stream)
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
 {
-    const std::regex numbers_regex{R"(( *)(\d+))"};
-    const auto time_line = stream.next_line();
-    std::sregex_iterator time_matches_itr{time_line.begin(), time_line.end(), numbers_regex};
-    const auto distance_line = stream.next_line();
-    std::sregex_iterator distance_matches_itr{distance_line.begin(), distance_line.end(), numbers_regex};
-    const std::sregex_iterator matches_end{};
-    
-    std::string time_string;
-    std::string distance_string;
-    while (time_matches_itr != matches_end)
+    return multiply_options(parse_races(read_lines(stream)));
+}
+
+namespace detail
+{
+auto parse_kerned_number(std::string_view line)
+{
+    auto number = 0ull;
+    for (const auto c : line)
     {
-        time_string += time_matches_itr->str(2);
-        distance_string += distance_matches_itr->str(2);
-        ++time_matches_itr;
-        ++distance_matches_itr;
+        if (std::isdigit(c))
+        {
+            const auto digit = static_cast<unsigned long long>(c - '0');
+            if (number > (std::numeric_limits<unsigned long long>::max() - digit) / 10)
+            {
+                throw std::out_of_range{"Kerned number does not fit: " + std::string{line}};
+            }
+            number = 10 * number + digit;
+        }
     }
-    const auto time = std::stoull(time_string);
-    const auto distance = std::stoull(distance_string);
+    return number;
+}
+
+Race parse_single_race(const Lines& lines)
+{
+    TIME_SCOPE("parse_single_race");
+    const auto time = parse_kerned_number(lines.time);
+    const auto distance = parse_kerned_number(lines.distance);
     return Race{time, distance};
 }
-} // namespace 
+} // namespace detail
 
 Answer solve_part2(utility::Stream& stream)
 {
-    const auto race = parse_single_race(stream);
+    const auto race = parse_single_race(read_lines(stream));
     const auto num_of_options = count_options(race);
     return num_of_options;
 }
-} // namespace task
+
+Answers solve_both(utility::Stream& stream)
+{
+    const auto lines = read_lines(stream);
+    const auto races = parse_races(lines);
+    const auto race = parse_single_race(lines);
+    return utility::run_concurrently(
+        [&races]() -> Answer { return multiply_options(races); },
+        [&race]() -> Answer { return count_options(race); });
+}
+} // namespace task::day06
 
@@ -0,0 +1,56 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <algorithm>
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::parse_games;
+namespace part1 = task::detail::part1;
+namespace part2 = task::detail::part2;
+
+constexpr std::string_view example{R"(32T3K 765
+T55J5 684
+KK677 28
+KTJJT 220
+QQQJA 483)"};
+
+void parse_games(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(parse_games(stream));
+    }
+    bench::set_throughput(state, input);
+}
+
+template <typename Compare>
+void sort_games(benchmark::State& state, Compare compare)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Stream stream{input};
+    const auto games = parse_games(stream);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto sorted_games = games;
+        state.ResumeTiming();
+        std::ranges::sort(sorted_games, compare);
+        benchmark::DoNotOptimize(sorted_games.data());
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_games)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(sort_games, part1, part1::compare_games)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(sort_games, part2, part2::compare_games)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
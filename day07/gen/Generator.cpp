@@ -0,0 +1,30 @@
+#include "gen/Generator.hpp"
+#include <string_view>
+
+namespace
+{
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr std::string_view figures{"23456789TJQKA"};
+    constexpr auto hand_size = 5u;
+    const auto hand_count = gen::scaled(scale, 1000);
+    for (auto hand = 0ull; hand < hand_count; ++hand)
+    {
+        if (hand > 0)
+        {
+            output.put('\n');
+        }
+        for (auto card = 0u; card < hand_size; ++card)
+        {
+            output.put(gen::pick(random, figures));
+        }
+        output.put(' ');
+        output.write_number(gen::uniform(random, 1, 1000));
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
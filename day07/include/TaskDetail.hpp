@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day07::detail
+{
+using Figure = char;
+using FigureCount = unsigned;
+struct Game
+{
+    using Cards = std::string;
+    Cards cards;
+    using Bid = unsigned;
+    Bid bid;
+    using FigureCountMap = std::unordered_map<Figure, FigureCount>;
+    FigureCountMap figure_count_map;
+};
+using Games = std::vector<Game>;
+
+Games parse_games(utility::Stream&);
+
+// Orders of the games by their winnings in each part.
+namespace part1
+{
+bool compare_games(const Game& lhs, const Game& rhs);
+} // namespace part1
+
+namespace part2
+{
+bool compare_games(const Game& lhs, const Game& rhs);
+} // namespace part2
+} // namespace task::day07::detail
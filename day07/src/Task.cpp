@@ -1,34 +1,24 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/ParseCache.hpp"
+#include "utility/Scanner.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
 #include <algorithm>
+#include <stdexcept>
 #include <unordered_map>
-#include <regex>
+#include <string_view>
 #include <vector>
 #include <ranges>
 
-namespace 
+namespace task::inline day07::detail
 {
-using Figure = char;
-using FigureCount = unsigned;
-struct Game
+auto create_game(std::string_view cards, Game::Bid bid)
 {
-    using Cards = std::string;
-    Cards cards;
-    using Bid = unsigned;
-    Bid bid;
-    using FigureCountMap = std::unordered_map<Figure, FigureCount>;
-    FigureCountMap figure_count_map;
-};
-using Games = std::vector<Game>;
-
-auto parse_game(const std::string& string)
-{
-    const std::regex game_regex{R"((.{5})( )(\d+))"};
-    std::smatch match;
-    std::regex_search(string, match, game_regex);
     Game game;
-    game.cards = match.str(1);
+    game.cards = cards;
     for (auto c : game.cards)
     {
         const auto [itr, inserted] = game.figure_count_map.emplace(c, FigureCount{1});
@@ -37,21 +27,68 @@ auto parse_game(const std::string& string)
             itr->second += 1;
         }
     }
-    game.bid = std::stoul(match.str(3));
+    game.bid = bid;
     return game;
 }
 
-auto parse_games(utility::Stream& stream)
+auto parse_game(std::string_view string)
+{
+    const auto [cards, bid] = utility::scan<"{s} {u}">(string);
+    return create_game(cards, static_cast<Game::Bid>(bid));
+}
+
+// Games are cached as their bids followed by their cards.
+constexpr utility::ParseCacheKey games_cache_key{"day07-games", 1};
+
+void save_games(utility::ParseCacheWriter& writer, const Games& games)
 {
+    std::vector<Game::Bid> bids;
+    std::vector<std::string_view> cards;
+    for (const auto& game : games)
+    {
+        bids.push_back(game.bid);
+        cards.push_back(game.cards);
+    }
+    writer.write_array<Game::Bid>(bids);
+    writer.write_strings(cards);
+}
+
+auto load_games(utility::ParseCacheReader& reader)
+{
+    const auto bids = reader.read_array<Game::Bid>();
+    const auto cards = reader.read_strings();
+    if (bids.size() != cards.size())
+    {
+        throw std::logic_error{"Parse cache is corrupted: games have different numbers of bids and cards"};
+    }
     Games games;
-    for (const auto& line : stream)
+    games.reserve(bids.size());
+    for (auto index = 0u; index < bids.size(); ++index)
     {
-        auto game = parse_game(line);
-        games.push_back(std::move(game));
+        games.push_back(create_game(cards[index], bids[index]));
     }
     return games;
 }
 
+Games parse_games(utility::Stream& stream)
+{
+    TIME_SCOPE("parse_games");
+    const auto parse = [](utility::Stream& stream) {
+        Games games;
+        for (const auto& line : stream)
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            auto game = parse_game(line);
+            games.push_back(std::move(game));
+        }
+        return games;
+    };
+    return utility::parse_cached(stream, games_cache_key, parse, save_games, load_games);
+}
+
 enum class Rank
 {
     high, one_pair, two_pair, three, full, four, five,
@@ -83,9 +120,33 @@ auto evaluate_rank(const Rank& rank, FigureCount count)
     }
     return Rank::high;
 }
-} // namespace
 
-namespace
+// Games are ordered through pointers, so that both parts can order the same games.
+// The order is a template argument, so that the sort calls it directly.
+template <auto compare>
+auto sum_winnings(const Games& games)
+{
+    std::vector<const Game*> order;
+    order.reserve(games.size());
+    for (const auto& game : games)
+    {
+        order.push_back(&game);
+    }
+    {
+        TIME_SCOPE("sort_games");
+        std::ranges::sort(order, [](const Game* lhs, const Game* rhs) { return compare(*lhs, *rhs); });
+    }
+    auto sum = 0ul;
+    for (auto index = 0u; index < order.size(); ++index)
+    {
+        const auto score = index + 1;
+        sum += order[index]->bid * score;
+    }
+    return sum;
+}
+} // namespace task::day07::detail
+
+namespace task::inline day07::detail
 {
 namespace part1
 {
@@ -114,7 +175,7 @@ Strength get_strength(const Figure c)
     return static_cast<Strength>(c - '0');
 }
 
-const auto compare_games = [](const Game& lhs, const Game& rhs)
+bool compare_games(const Game& lhs, const Game& rhs)
 {
     const auto lhs_rank = evaluate_rank(lhs.figure_count_map);
     const auto rhs_rank = evaluate_rank(rhs.figure_count_map);
@@ -124,27 +185,22 @@ const auto compare_games = [](const Game& lhs, const Game& rhs)
     }
     const auto [itr1, itr2] = std::ranges::mismatch(lhs.cards, rhs.cards);
     return get_strength(*itr1) < get_strength(*itr2);
-};
+}
 } // namespace part1
-} // namespace 
+} // namespace task::day07::detail
 
-namespace task
+namespace task::inline day07
 {
+using namespace detail;
+
 Answer solve_part1(utility::Stream& stream)
 {
-    auto games = parse_games(stream);
-    std::ranges::sort(games, part1::compare_games);
-    auto sum = 0ul;
-    for (auto index = 0u; index < games.size(); ++index)
-    {
-        const auto score = index + 1;
-        sum += games[index].bid * score;
-    }
-    return sum;
+    const auto games = parse_games(stream);
+    return sum_winnings<part1::compare_games>(games);
 }
-} // namespace task
+} // namespace task::day07
 
-namespace
+namespace task::inline day07::detail
 {
 namespace part2
 {
@@ -212,7 +268,7 @@ Strength get_strength(const Figure c)
     return static_cast<Strength>(c - '0');
 }
 
-const auto compare_games = [](const Game& lhs, const Game& rhs)
+bool compare_games(const Game& lhs, const Game& rhs)
 {
     const auto lhs_rank = evaluate_rank(lhs.figure_count_map);
     const auto rhs_rank = evaluate_rank(rhs.figure_count_map);
@@ -222,23 +278,24 @@ const auto compare_games = [](const Game& lhs, const Game& rhs)
     }
     const auto [itr1, itr2] = std::ranges::mismatch(lhs.cards, rhs.cards);
     return get_strength(*itr1) < get_strength(*itr2);
-};
+}
 } // namespace part2
-} // namespace 
+} // namespace task::day07::detail
 
-namespace task
+namespace task::inline day07
 {
 Answer solve_part2(utility::Stream& stream)
 {
-    auto games = parse_games(stream);
-    std::ranges::sort(games, part2::compare_games);
-    auto sum = 0ul;
-    for (auto index = 0u; index < games.size(); ++index)
-    {
-        const auto score = index + 1;
-        sum += games[index].bid * score;
-    }
-    return sum;
+    const auto games = parse_games(stream);
+    return sum_winnings<part2::compare_games>(games);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    const auto games = parse_games(stream);
+    return utility::run_concurrently(
+        [&games]() -> Answer { return sum_winnings<part1::compare_games>(games); },
+        [&games]() -> Answer { return sum_winnings<part2::compare_games>(games); });
 }
-} // namespace task
+} // namespace task::day07
 
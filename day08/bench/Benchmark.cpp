@@ -0,0 +1,118 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::count_steps;
+using task::detail::Directions;
+using task::detail::NodeId;
+using task::detail::parse_map;
+using task::detail::StepCount;
+
+constexpr std::string_view example_part1{R"(RL
+
+AAA = (BBB, CCC)
+BBB = (DDD, EEE)
+CCC = (ZZZ, GGG)
+DDD = (DDD, DDD)
+EEE = (EEE, EEE)
+GGG = (GGG, GGG)
+ZZZ = (ZZZ, ZZZ))"};
+
+constexpr std::string_view example_part2{R"(LR
+
+QQA = (QQB, XXX)
+QQB = (XXX, QQZ)
+QQZ = (QQB, XXX)
+RRA = (RRB, XXX)
+RRB = (RRC, RRC)
+RRC = (RRZ, RRZ)
+RRZ = (RRB, RRB)
+XXX = (XXX, XXX))"};
+
+NodeId make_node_id(std::int64_t index)
+{
+    NodeId id(3, 'A');
+    for (auto itr = id.rbegin(); itr != id.rend(); ++itr, index /= 26)
+    {
+        *itr = static_cast<char>('A' + index % 26);
+    }
+    return id;
+}
+
+// Network of `count` nodes chained from AAA to ZZZ, so that part 1 takes `count - 1` steps.
+std::string make_chain(std::int64_t count)
+{
+    std::string network{"LR\n"};
+    const auto get_id = [count](std::int64_t index) {
+        return index == count - 1 ? NodeId{"ZZZ"} : make_node_id(index);
+    };
+    for (std::int64_t index{0}; index < count; ++index)
+    {
+        const auto next_id = get_id(std::min(index + 1, count - 1));
+        network += '\n' + get_id(index) + " = (" + next_id + ", " + next_id + ")";
+    }
+    return network;
+}
+
+// The first argument of 1 selects the puzzle example, larger ones a generated chain of that length.
+std::string get_network(const benchmark::State& state)
+{
+    const auto count = state.range(0);
+    return count == 1 ? std::string{example_part1} : make_chain(count);
+}
+
+void parse_map(benchmark::State& state)
+{
+    const auto input = get_network(state);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        stream.skip(2);
+        benchmark::DoNotOptimize(parse_map(stream));
+    }
+    bench::set_throughput(state, input);
+}
+
+void count_steps(benchmark::State& state)
+{
+    const auto input = get_network(state);
+    utility::Stream stream{input};
+    const Directions directions{stream.next_line()};
+    stream.skip();
+    const auto map = parse_map(stream);
+    const auto is_end_node = [](const NodeId& id) { return id == "ZZZ"; };
+    StepCount step_count{0};
+    for (auto _ : state)
+    {
+        step_count = count_steps(map, directions, NodeId{"AAA"}, is_end_node);
+        benchmark::DoNotOptimize(step_count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(step_count));
+}
+
+void solve_part1(benchmark::State& state)
+{
+    const auto input = get_network(state);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(task::solve_part1(stream));
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_map)->Arg(1)->Arg(10000);
+BENCHMARK(count_steps)->Arg(1)->Arg(10000);
+BENCHMARK(solve_part1)->Arg(1)->Arg(10000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example_part2, task::solve_part2)->Arg(1)->UseRealTime();
+
+BENCHMARK_MAIN();
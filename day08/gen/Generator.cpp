@@ -0,0 +1,84 @@
+#include "gen/Generator.hpp"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+using NodeId = std::string;
+using NodeIds = std::vector<NodeId>;
+
+// Identifiers which are neither start nor end nodes, in random order.
+NodeIds create_intermediate_ids(gen::Random& random)
+{
+    NodeIds ids;
+    for (auto first = 'A'; first <= 'Z'; ++first)
+    {
+        for (auto second = 'A'; second <= 'Z'; ++second)
+        {
+            for (auto third = 'B'; third < 'Z'; ++third)
+            {
+                ids.push_back(NodeId{first, second, third});
+            }
+        }
+    }
+    std::ranges::shuffle(ids, random);
+    return ids;
+}
+
+void write_node(gen::Output& output, const NodeId& id, const NodeId& next_id)
+{
+    output.put('\n');
+    output.write(id);
+    output.write(" = (");
+    output.write(next_id);
+    output.write(", ");
+    output.write(next_id);
+    output.put(')');
+}
+
+// Each ghost walks from its start node to its end node and from there around the same cycle again, whichever
+// direction it takes. Cycle lengths are multiples of distinct primes, as in the puzzle input. The number of nodes is
+// limited by the three letter identifiers, so at larger scales only the directions grow.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr auto directions{"LR"};
+    const auto direction_count = gen::scaled(scale, 263);
+    for (auto direction = 0ull; direction < direction_count; ++direction)
+    {
+        output.put(gen::pick(random, std::string_view{directions}));
+    }
+    output.put('\n');
+
+    constexpr std::array<std::uint64_t, 6> cycle_primes{43, 47, 53, 59, 61, 67};
+    constexpr auto prime_sum = 330u;
+    constexpr auto max_node_count = 16000u;
+    const auto node_count = std::min<std::uint64_t>(gen::scaled(scale, 700), max_node_count);
+    const auto cycle_multiplier = std::max<std::uint64_t>(1, node_count / prime_sum);
+
+    const auto intermediate_ids = create_intermediate_ids(random);
+    auto id_itr = intermediate_ids.begin();
+    for (auto ghost = 0u; ghost < cycle_primes.size(); ++ghost)
+    {
+        const auto letter = static_cast<char>('A' + ghost);
+        const NodeId start_id{letter, letter, 'A'};
+        const NodeId end_id = ghost == 0 ? NodeId{"ZZZ"} : NodeId{letter, letter, 'Z'};
+        const auto cycle_length = cycle_primes[ghost] * cycle_multiplier;
+        const auto first_id_itr = id_itr;
+        id_itr += static_cast<std::ptrdiff_t>(cycle_length - 1);
+
+        write_node(output, start_id, *first_id_itr);
+        for (auto itr = first_id_itr; itr != id_itr; ++itr)
+        {
+            write_node(output, *itr, std::next(itr) == id_itr ? end_id : *std::next(itr));
+        }
+        write_node(output, end_id, *first_id_itr);
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
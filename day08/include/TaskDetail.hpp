@@ -0,0 +1,33 @@
+#pragma once
+
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day08::detail
+{
+using Direction = char;
+using Directions = std::string;
+
+using NodeId = std::string;
+struct Node
+{
+    NodeId left, right;
+};
+using NodeMap = std::pmr::unordered_map<NodeId, Node>;
+
+// Nodes are allocated from the current arena.
+NodeMap parse_map(utility::Stream&);
+
+using StepCount = unsigned long long;
+
+using StopPredicate = std::function<bool (NodeId)>;
+StepCount count_steps(const NodeMap&, const Directions&, NodeId current_id, StopPredicate);
+} // namespace task::day08::detail
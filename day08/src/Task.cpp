@@ -1,46 +1,93 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Arena.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/ParseCache.hpp"
+#include "utility/Scanner.hpp"
 #include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
 #include <unordered_map>
 #include <ranges>
-#include <regex>
+#include <string_view>
 #include <numeric>
+#include <vector>
 
-namespace 
+namespace task::inline day08::detail
 {
-using Direction = char;
-using Directions = std::string;
 constexpr auto left = 'L';
 
-using NodeId = std::string;
-struct Node
+NodeMap parse_map(utility::Stream& stream)
 {
-    NodeId left, right;
-};
-using NodeMap = std::unordered_map<NodeId, Node>;
+    TIME_SCOPE("parse_map");
+    NodeMap map{utility::get_current_resource()};
+    for (const auto& line : stream)
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        const auto [node_id, left_id, right_id] = utility::scan<"{s} = ({s}, {s})">(line);
+        map.emplace(NodeId{node_id}, Node{NodeId{left_id}, NodeId{right_id}});
+    }
+    return map;
+}
 
-auto parse_map(utility::Stream& stream)
+struct Network
 {
-    const std::regex regex{R"(([A-Z]{3})(.*?)([A-Z]{3})(.*?)([A-Z]{3})(.*))"};
+    Directions directions;
     NodeMap map;
-    for (const auto& line : stream)
+};
+
+// Networks are cached as the directions followed by the ids of each node and of its left and right nodes.
+constexpr utility::ParseCacheKey network_cache_key{"day08-network", 1};
+
+void save_network(utility::ParseCacheWriter& writer, const Network& network)
+{
+    writer.write_string(network.directions);
+    std::vector<std::string_view> ids;
+    ids.reserve(network.map.size() * 3);
+    for (const auto& [id, node] : network.map)
     {
-        std::smatch match;
-        std::regex_search(line, match, regex);
-        auto node_id = match.str(1);
-        auto left_id = match.str(3);
-        auto right_id = match.str(5);
-        map.emplace(std::move(node_id), Node{std::move(left_id), std::move(right_id)});
+        ids.insert(ids.end(), {id, node.left, node.right});
     }
-    return map;
+    writer.write_strings(ids);
 }
 
-using StepCount = unsigned long long;
+auto load_network(utility::ParseCacheReader& reader)
+{
+    Network network{Directions{reader.read_string()}, NodeMap{utility::get_current_resource()}};
+    const auto ids = reader.read_strings();
+    if (ids.size() % 3 != 0)
+    {
+        throw std::logic_error{"Parse cache is corrupted: nodes are incomplete"};
+    }
+    network.map.reserve(ids.size() / 3);
+    for (auto index = 0u; index < ids.size(); index += 3)
+    {
+        network.map.emplace(NodeId{ids[index]}, Node{NodeId{ids[index + 1]}, NodeId{ids[index + 2]}});
+    }
+    return network;
+}
 
-using StopPredicate = std::function<bool (NodeId)>;
-auto count_steps(const NodeMap& map, const Directions& directions, NodeId current_id, StopPredicate predicate)
+auto parse_network(utility::Stream& stream)
 {
+    const auto parse = [](utility::Stream& stream) {
+        Directions directions{stream.next_line()};
+        stream.skip();
+        return Network{std::move(directions), parse_map(stream)};
+    };
+    return utility::parse_cached(stream, network_cache_key, parse, save_network, load_network);
+}
+
+StepCount count_steps(const NodeMap& map, const Directions& directions, NodeId current_id, StopPredicate predicate)
+{
+    TIME_SCOPE("count_steps");
     auto direction_itr = directions.cbegin();
     StepCount step_count{0};
     while (not predicate(current_id))
@@ -59,38 +106,57 @@ auto count_steps(const NodeMap& map, const Directions& directions, NodeId curren
     }
     return step_count;
 }
-} // namespace 
 
-namespace task
-{
-Answer solve_part1(utility::Stream& stream)
+auto count_steps_from_aaa(const NodeMap& map, const Directions& directions)
 {
-    const auto directions = stream.next_line();
-    stream.skip();
-    const auto map = parse_map(stream);
-
     const NodeId start_id{"AAA"};
     const NodeId end_id{"ZZZ"};
     const auto is_end_node = [&end_id](const NodeId& id) { return id == end_id; };
-    const auto step_count = count_steps(map, directions, start_id, is_end_node);
-    return step_count;
+    return count_steps(map, directions, start_id, is_end_node);
 }
 
-Answer solve_part2(utility::Stream& stream)
+auto count_ghost_steps(const NodeMap& map, const Directions& directions)
 {
-    const auto directions = stream.next_line();
-    stream.skip();
-    const auto map = parse_map(stream);
-
     const auto is_start_node = [](const NodeId& id) { return id[2] == 'A'; };
     const auto is_end_node = [](const NodeId& id) { return id[2] == 'Z'; };
-    StepCount lcm = count_steps(map, directions, map.begin()->first, is_end_node);
-    for (const auto& current_id : std::views::keys(map) | std::views::drop(1) | std::views::filter(is_start_node))
-    {
-        const auto step_count = count_steps(map, directions, current_id, is_end_node);
-        lcm = std::lcm(lcm, step_count);
-    }
-    return lcm;
+    std::vector<NodeId> start_ids;
+    std::ranges::copy(std::views::keys(map) | std::views::filter(is_start_node), std::back_inserter(start_ids));
+    const auto count_start_steps = [&](std::size_t index) {
+        return count_steps(map, directions, start_ids[index], is_end_node);
+    };
+    const auto lcm = [](StepCount lhs, StepCount rhs) { return std::lcm(lhs, rhs); };
+    constexpr auto start_per_task = 1u;
+    return utility::parallel_reduce(0, start_ids.size(), StepCount{1}, count_start_steps, lcm, start_per_task);
 }
-} // namespace task
+} // namespace task::day08::detail
+
+namespace task::inline day08
+{
+using namespace detail;
 
+Answer solve_part1(utility::Stream& stream)
+{
+    utility::Arena arena;
+    const utility::ArenaScope arena_scope{arena};
+    const auto [directions, map] = parse_network(stream);
+    return count_steps_from_aaa(map, directions);
+}
+
+Answer solve_part2(utility::Stream& stream)
+{
+    utility::Arena arena;
+    const utility::ArenaScope arena_scope{arena};
+    const auto [directions, map] = parse_network(stream);
+    return count_ghost_steps(map, directions);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    utility::Arena arena;
+    const utility::ArenaScope arena_scope{arena};
+    const auto network = parse_network(stream);
+    return utility::run_concurrently(
+        [&network]() -> Answer { return count_steps_from_aaa(network.map, network.directions); },
+        [&network]() -> Answer { return count_ghost_steps(network.map, network.directions); });
+}
+} // namespace task::day08
@@ -0,0 +1,64 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using bench::solve;
+using task::detail::contains_only_zeros;
+using task::detail::get_differences;
+using task::detail::Numbers;
+using task::detail::parse_numbers;
+
+constexpr std::string_view example{R"(0 3 6 9 12 15
+1 3 6 10 15 21
+10 13 16 21 30 45)"};
+
+void parse_numbers(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        for (const auto line : stream)
+        {
+            benchmark::DoNotOptimize(parse_numbers(line));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+
+void get_differences(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    std::vector<Numbers> histories;
+    utility::Stream stream{input};
+    for (const auto line : stream)
+    {
+        histories.push_back(parse_numbers(line));
+    }
+    for (auto _ : state)
+    {
+        for (const auto& history : histories)
+        {
+            auto numbers = history;
+            while (not contains_only_zeros(numbers))
+            {
+                numbers = get_differences(numbers);
+            }
+            benchmark::DoNotOptimize(numbers.data());
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_numbers)->Arg(1)->Arg(1000);
+BENCHMARK(get_differences)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
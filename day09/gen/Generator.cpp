@@ -0,0 +1,45 @@
+#include "gen/Generator.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+// Histories are values of random polynomials of degree up to 5, so that the differences reach zero.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr auto value_count = 21;
+    constexpr auto max_degree = 5u;
+    constexpr auto max_coefficient = 9;
+    const auto history_count = gen::scaled(scale, 200);
+    for (auto history = 0ull; history < history_count; ++history)
+    {
+        if (history > 0)
+        {
+            output.put('\n');
+        }
+        std::vector<std::int64_t> coefficients(gen::uniform(random, 0, max_degree) + 1);
+        for (auto& coefficient : coefficients)
+        {
+            coefficient = static_cast<std::int64_t>(gen::uniform(random, 0, 2 * max_coefficient)) - max_coefficient;
+        }
+        for (auto x = 0; x < value_count; ++x)
+        {
+            std::int64_t value{0};
+            for (auto itr = coefficients.rbegin(); itr != coefficients.rend(); ++itr)
+            {
+                value = value * x + *itr;
+            }
+            if (x > 0)
+            {
+                output.put(' ');
+            }
+            output.write_number(value);
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day09::detail
+{
+using Number = long;
+using Numbers = std::vector<Number>;
+Numbers parse_numbers(std::string_view);
+
+bool contains_only_zeros(const Numbers&);
+
+Numbers get_differences(const Numbers&);
+} // namespace task::day09::detail
@@ -1,33 +1,34 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
 #include "utility/Stream.hpp"
-#include <regex>
+#include "utility/Timer.hpp"
+#include "utility/Tokenizer.hpp"
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 
-namespace
+namespace task::inline day09::detail
 {
-using Number = long;
-using Numbers = std::vector<Number>;
-auto parse_numbers(const std::string& string)
+Numbers parse_numbers(std::string_view string)
 {
-    const std::regex regex{R"([\d\-]+)"};
-    const std::sregex_iterator numbers_begin{string.cbegin(), string.cend(), regex};
-    const std::sregex_iterator numbers_end{};
+    TIME_SCOPE("parse_numbers");
     Numbers numbers;
-    const auto get_number = [](const auto& m) { return std::stol(m.str()); };
-    std::transform(numbers_begin, numbers_end, std::back_inserter(numbers), get_number);
+    std::ranges::copy(utility::Integers<Number>{string}, std::back_inserter(numbers));
     return numbers;
 }
 
-auto contains_only_zeros(const Numbers& numbers)
+bool contains_only_zeros(const Numbers& numbers)
 {
     return std::ranges::all_of(numbers, [](auto n){ return n == 0; });
 }
 
-auto get_differences(const Numbers& numbers)
+Numbers get_differences(const Numbers& numbers)
 {
     Numbers result;
     if (numbers.empty())
@@ -44,46 +45,89 @@ auto get_differences(const Numbers& numbers)
     }
     return result;
 }
-} // namespace 
 
-namespace task
+Number extrapolate_forwards(std::string_view line)
 {
-Answer solve_part1(utility::Stream& stream)
-{
-    Number sum{};
-    for (const auto& line : stream)
+    TIME_SCOPE("extrapolate_forwards");
+    auto numbers = parse_numbers(line);
+    Number sum{numbers.back()};
+    while (not contains_only_zeros(numbers))
     {
-        auto numbers = parse_numbers(line);
+        numbers = get_differences(numbers);
         sum += numbers.back();
-        while (not contains_only_zeros(numbers))
-        {
-            numbers = get_differences(numbers);
-            sum += numbers.back();
-        }
     }
     return sum;
 }
 
-Answer solve_part2(utility::Stream& stream)
+Number extrapolate_backwards(std::string_view line)
 {
-    Number sum{0};
-    for (const auto& line : stream)
+    TIME_SCOPE("extrapolate_backwards");
+    auto numbers = parse_numbers(line);
+    Numbers front_numbers{numbers.front()};
+    while (not contains_only_zeros(numbers))
     {
-        auto numbers = parse_numbers(line);
-        Numbers front_numbers{numbers.front()};
-        while (not contains_only_zeros(numbers))
-        {
-            numbers = get_differences(numbers);
-            front_numbers.push_back(numbers.front());
-        }
-        Number extrapolated{};
-        for (auto itr = front_numbers.rbegin(); itr != front_numbers.rend(); ++itr)
-        {
-            extrapolated = *itr - extrapolated;
-        }
-        sum += extrapolated;
+        numbers = get_differences(numbers);
+        front_numbers.push_back(numbers.front());
     }
-    return sum;
+    Number extrapolated{};
+    for (auto itr = front_numbers.rbegin(); itr != front_numbers.rend(); ++itr)
+    {
+        extrapolated = *itr - extrapolated;
+    }
+    return extrapolated;
+}
+
+// Extrapolates in both directions from a single sequence of differences.
+std::pair<Number, Number> extrapolate_both(std::string_view line)
+{
+    TIME_SCOPE("extrapolate_both");
+    auto numbers = parse_numbers(line);
+    Number sum{numbers.back()};
+    Numbers front_numbers{numbers.front()};
+    while (not contains_only_zeros(numbers))
+    {
+        numbers = get_differences(numbers);
+        sum += numbers.back();
+        front_numbers.push_back(numbers.front());
+    }
+    Number extrapolated{};
+    for (auto itr = front_numbers.rbegin(); itr != front_numbers.rend(); ++itr)
+    {
+        extrapolated = *itr - extrapolated;
+    }
+    return {sum, extrapolated};
+}
+} // namespace task::day09::detail
+
+namespace task::inline day09
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    return utility::parallel_line_reduce(stream, Number{}, extrapolate_forwards);
+}
+
+Answer solve_part2(utility::Stream& stream)
+{
+    return utility::parallel_line_reduce(stream, Number{0}, extrapolate_backwards);
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    const auto [forwards, backwards] = utility::parallel_line_reduce(
+        stream, std::pair<Number, Number>{}, extrapolate_both, utility::PairPlus{});
+    return Answers{static_cast<Answer>(forwards), static_cast<Answer>(backwards)};
+}
+
+Answer get_line_term_part1(std::string_view line)
+{
+    return static_cast<Answer>(extrapolate_forwards(line));
+}
+
+Answer get_line_term_part2(std::string_view line)
+{
+    return static_cast<Answer>(extrapolate_backwards(line));
 }
-} // namespace task
+} // namespace task::day09
 
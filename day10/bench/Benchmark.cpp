@@ -0,0 +1,59 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::create_loop;
+using task::detail::parse_map;
+
+constexpr std::string_view example_part1{R"(..F7.
+.FJ|.
+SJ.L7
+|F--J
+LJ...)"};
+
+constexpr std::string_view example_part2{R"(...........
+.S-------7.
+.|F-----7|.
+.||.....||.
+.||.....||.
+.|L-7.F-J|.
+.|..|.|..|.
+.L--J.L--J.
+...........)"};
+
+void parse_map(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example_part2);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        benchmark::DoNotOptimize(parse_map(stream));
+    }
+    bench::set_throughput(state, input);
+}
+
+void create_loop(benchmark::State& state, std::string_view example)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Stream stream{input};
+    const auto map = parse_map(stream);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(create_loop(map));
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_map)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(create_loop, part1, example_part1)->Arg(1);
+BENCHMARK_CAPTURE(create_loop, part2, example_part2)->Arg(1);
+BENCHMARK_CAPTURE(solve, part1, example_part1, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example_part2, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
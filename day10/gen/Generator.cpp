@@ -0,0 +1,75 @@
+#include "gen/Generator.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using Map = std::vector<std::string>;
+
+// Loop along the border of the map with teeth hanging down from its top edge, which makes both the loop and the
+// enclosed area grow with the map. Tiles which are not part of the loop are random pipes.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr std::string_view junk_symbols{"|-LJ7F."};
+    const auto side = std::max<std::uint64_t>(8, gen::scaled_side(scale, 140));
+    Map map(side, std::string(side, '.'));
+    for (auto& row : map)
+    {
+        for (auto& tile : row)
+        {
+            tile = gen::pick(random, junk_symbols);
+        }
+    }
+
+    const auto last = side - 2;
+    for (auto x = 2ull; x < last; ++x)
+    {
+        map[1][x] = '-';
+        map[last][x] = '-';
+    }
+    for (auto y = 2ull; y < last; ++y)
+    {
+        map[y][1] = '|';
+        map[y][last] = '|';
+    }
+    map[0][1] = '.';
+    map[1][1] = 'S';
+    map[1][last] = '7';
+    map[last][1] = 'L';
+    map[last][last] = 'J';
+
+    for (auto x = 2ull; x + 1 < last; ++x)
+    {
+        if (not gen::chance(random, 0.3))
+        {
+            continue;
+        }
+        const auto bottom = gen::uniform(random, 2, side - 4);
+        map[1][x] = '7';
+        map[1][x + 1] = 'F';
+        for (auto y = 2ull; y < bottom; ++y)
+        {
+            map[y][x] = '|';
+            map[y][x + 1] = '|';
+        }
+        map[bottom][x] = 'L';
+        map[bottom][x + 1] = 'J';
+        ++x;
+    }
+
+    for (auto y = 0ull; y < side; ++y)
+    {
+        if (y > 0)
+        {
+            output.put('\n');
+        }
+        output.write(map[y]);
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
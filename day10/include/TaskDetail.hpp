@@ -0,0 +1,28 @@
+#pragma once
+
+#include "utility/Grid.hpp"
+#include <cstddef>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day10::detail
+{
+using Symbol = char;
+using Map = utility::Grid<Symbol>;
+using Position = Map::Index;
+Map parse_map(utility::Stream&);
+
+using LoopMap = utility::Grid<Symbol>;
+
+struct Loop
+{
+    LoopMap tiles;
+    std::size_t length;
+};
+
+Loop create_loop(const Map&);
+} // namespace task::day10::detail
@@ -1,74 +1,29 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Grid.hpp"
 #include "utility/Stream.hpp"
-#include <string>
-#include <vector>
-#include <unordered_map>
-#include <functional>
-#include <ranges>
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
 
-namespace
+namespace task::inline day10::detail
 {
-using Row = std::string;
-using Map = std::vector<Row>;
+constexpr Symbol empty_symbol{'.'};
 
-struct Vector
+Map parse_map(utility::Stream& stream)
 {
-    int x{}, y{};
-};
-struct VectorHash
-{
-    std::size_t operator()(const Vector& v) const
-    {
-        const auto hash_x = std::hash<int>{}(v.x);
-        const auto hash_y = std::hash<int>{}(v.y);
-        return hash_x ^ (hash_y << 1);
-    }
-};
-bool operator==(const Vector& lhs, const Vector& rhs)
-{
-    return lhs.x == rhs.x and lhs.y == rhs.y;
-}
-
-auto get_size(const Map& map)
-{
-    if (map.empty())
-    {
-        return Vector{0, 0};
-    }
-    const auto& row = map.front();
-    return Vector{static_cast<int>(row.length()), static_cast<int>(map.size())};
-}
-
-bool is_within_bounds(const Map& map, const Vector& position)
-{
-    const auto map_size = get_size(map);
-    const auto within_x = position.x >= 0 and position.x < map_size.x; 
-    const auto within_y = position.y >= 0 and position.y < map_size.y; 
-    return within_x and within_y;
-}
-
-auto get_symbol(const Map& map, const Vector& position)
-{
-    return map[position.y][position.x];
+    TIME_SCOPE("parse_map");
+    constexpr auto padding = 1;
+    return utility::parse_grid(stream, empty_symbol, padding);
 }
 
-auto parse_map(utility::Stream& stream)
-{
-    Map map;
-    for (const auto& line : stream)
-    {
-        map.push_back(line);
-    }
-    return map;
-}
-
-using Symbol = char;
-using Symbols = std::vector<Symbol>;
 struct Tile
 {
     Symbol symbol;
-    Vector position;
+    Position position;
 };
 
 enum class Direction
@@ -76,51 +31,36 @@ enum class Direction
     up, down, left, right
 };
 
-auto get_adjacent(Vector position, const Direction direction)
+auto get_adjacent(const Map& map, Position position, const Direction direction)
 {
     switch (direction)
     {
-        case Direction::up: --position.y; break;
-        case Direction::down: ++position.y; break;
-        case Direction::left: --position.x; break;
-        case Direction::right: ++position.x; break;
+        case Direction::up: return position + map.get_offset(0, -1);
+        case Direction::down: return position + map.get_offset(0, 1);
+        case Direction::left: return position + map.get_offset(-1, 0);
+        case Direction::right: return position + map.get_offset(1, 0);
     }
     return position;
 }
 
 auto find_start_position(const Map& map)
 {
-    for (auto y = 0u; y < map.size(); ++y)
+    const auto cells = map.get_cells();
+    if (const auto itr = std::ranges::find(cells, 'S'); itr != cells.end())
     {
-        const auto& row = map[y];
-        if (const auto x = row.find('S'); x != std::string::npos)
-        {
-            return Vector{static_cast<int>(x), static_cast<int>(y)};
-        }
+        return static_cast<Position>(itr - cells.begin());
     }
     throw std::logic_error{"Start not found"};
 }
 
-auto find_start_symbol(const Map& map, const Vector& position)
+auto find_start_symbol(const Map& map, const Position position)
 {
-    auto connected_to_top = false;
-    auto connected_to_bottom = false;
-    auto connected_to_right = false;
-    if (const auto above = get_adjacent(position, Direction::up); is_within_bounds(map, above))
-    {
-        const auto symbol = get_symbol(map, above);
-        connected_to_top = (symbol == '|' or symbol == '7' or symbol == 'F');
-    }
-    if (const auto below = get_adjacent(position, Direction::down); is_within_bounds(map, below))
-    {
-        const auto symbol = get_symbol(map, below);
-        connected_to_bottom = (symbol == '|' or symbol == 'J' or symbol == 'L');
-    }
-    if (const auto right = get_adjacent(position, Direction::right); is_within_bounds(map, right))
-    {
-        const auto symbol = get_symbol(map, right);
-        connected_to_right = (symbol == '-' or symbol == '7' or symbol == 'J');
-    }
+    const auto above = map[get_adjacent(map, position, Direction::up)];
+    const auto connected_to_top = (above == '|' or above == '7' or above == 'F');
+    const auto below = map[get_adjacent(map, position, Direction::down)];
+    const auto connected_to_bottom = (below == '|' or below == 'J' or below == 'L');
+    const auto right = map[get_adjacent(map, position, Direction::right)];
+    const auto connected_to_right = (right == '-' or right == '7' or right == 'J');
     if (connected_to_top)
     {
         if (connected_to_bottom)
@@ -178,39 +118,49 @@ auto pick_next_direction(const Symbol& symbol, const Direction previous_directio
     return previous_direction;
 }
 
-using TileMap = std::unordered_map<Vector, Symbol, VectorHash>;
-
-auto create_loop(const Map& map)
+constexpr Symbol outside_loop{'\0'};
+Loop create_loop(const Map& map)
 {
-    TileMap tile_map;
+    TIME_SCOPE("create_loop");
+    Loop loop{LoopMap{map.get_width(), map.get_height(), outside_loop, map.get_padding()}, 0u};
+    const auto add_tile = [&loop](const Position position, const Symbol symbol) {
+        auto& tile = loop.tiles[position];
+        if (tile == outside_loop)
+        {
+            tile = symbol;
+            ++loop.length;
+        }
+    };
     const auto start = find_start_tile(map);
-    tile_map.emplace(start.position, start.symbol);
+    add_tile(start.position, start.symbol);
     auto direction = pick_first_direction(start.symbol);
-    auto position = get_adjacent(start.position, direction);
-    auto symbol = get_symbol(map, position);
-    tile_map.emplace(position, symbol);
+    auto position = get_adjacent(map, start.position, direction);
+    auto symbol = map[position];
+    add_tile(position, symbol);
     while (symbol != 'S')
     {
         direction = pick_next_direction(symbol, direction);
-        position = get_adjacent(position, direction);
-        symbol = get_symbol(map, position);
-        tile_map.emplace(position, symbol);
+        position = get_adjacent(map, position, direction);
+        symbol = map[position];
+        add_tile(position, symbol);
     }
-    return tile_map;
+    return loop;
 }
-} // namespace
+} // namespace task::day10::detail
 
-namespace task
+namespace task::inline day10
 {
+using namespace detail;
+
 Answer solve_part1(utility::Stream& stream)
 {
     const auto map = parse_map(stream);
     const auto loop = create_loop(map);
-    return loop.size() / 2;
+    return loop.length / 2;
 }
-} // namespace task
+} // namespace task::day10
 
-namespace
+namespace task::inline day10::detail
 {
 bool is_corner(const Symbol symbol)
 {
@@ -227,19 +177,17 @@ bool are_mutually_exclusive(const Symbol s1, const Symbol s2)
     }
     return false;
 }
-bool is_inside(const Map& map, const TileMap& loop, const Vector& position)
+bool is_inside(const LoopMap& loop, const Position position, const Position row_end)
 {
-    const auto row_size = get_size(map).x;
     auto num_of_crossings = 0u;
     std::optional<Symbol> prev_corner;
-    for (auto x = position.x + 1; x < row_size; ++x)
+    for (auto next_position = position + 1; next_position < row_end; ++next_position)
     {
-        const Vector next_position{x, position.y};
-        if (not loop.contains(next_position))
+        const auto next_symbol = loop[next_position];
+        if (next_symbol == outside_loop)
         {
             continue;
         }
-        const auto next_symbol = loop.at(next_position);
         if (next_symbol == '|')
         {
             ++num_of_crossings;
@@ -263,32 +211,45 @@ bool is_inside(const Map& map, const TileMap& loop, const Vector& position)
     }
     return (num_of_crossings % 2) == 1;
 }
-} // namespace
 
-namespace task
-{
-Answer solve_part2(utility::Stream& stream)
+auto count_tiles_inside(const Map& map, const Loop& loop)
 {
-    const auto map = parse_map(stream);
-    const auto loop = create_loop(map);
-    const auto map_size = get_size(map);
-    auto num_of_tiles_inside = 0u;
-    for (auto y = 0; y < map_size.y; ++y)
-    {
-        for (auto x = 0; x < map_size.x; ++x)
+    TIME_SCOPE("count_tiles_inside");
+    const auto count_row_tiles_inside = [&map, &loop](std::size_t row) {
+        const auto y = static_cast<int>(row);
+        const auto row_end = loop.tiles.to_index(map.get_width(), y);
+        auto num_of_tiles_inside = 0u;
+        for (auto position = loop.tiles.to_index(0, y); position < row_end; ++position)
         {
-            const Vector position{x, y};
-            if (loop.contains(position))
+            if (loop.tiles[position] != outside_loop)
             {
                 continue;
             }
-            if (is_inside(map, loop, position))
+            if (is_inside(loop.tiles, position, row_end))
             {
                 ++num_of_tiles_inside;
             }
         }
-    }
-    return num_of_tiles_inside;
+        return num_of_tiles_inside;
+    };
+    const auto height = static_cast<std::size_t>(map.get_height());
+    return utility::parallel_reduce(0, height, 0u, count_row_tiles_inside);
+}
+} // namespace task::day10::detail
+
+namespace task::inline day10
+{
+Answer solve_part2(utility::Stream& stream)
+{
+    const auto map = parse_map(stream);
+    const auto loop = create_loop(map);
+    return count_tiles_inside(map, loop);
 }
-} // namespace task
 
+Answers solve_both(utility::Stream& stream)
+{
+    const auto map = parse_map(stream);
+    const auto loop = create_loop(map);
+    return Answers{loop.length / 2, count_tiles_inside(map, loop)};
+}
+} // namespace task::day10
@@ -0,0 +1,65 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Stream.hpp"
+#include <cstdint>
+#include <string_view>
+
+namespace
+{
+using bench::solve;
+using task::detail::collect_galaxy_positions;
+using task::detail::count_all_steps;
+using task::detail::get_coords_of_empty_columns;
+using task::detail::get_coords_of_empty_rows;
+using task::detail::parse_symbol_map;
+
+constexpr std::string_view example{R"(...#......
+.......#..
+#.........
+..........
+......#...
+.#........
+.........#
+..........
+.......#..
+#...#.....)"};
+
+void parse_symbol_map(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        const auto symbol_map = parse_symbol_map(stream);
+        benchmark::DoNotOptimize(collect_galaxy_positions(symbol_map));
+        benchmark::DoNotOptimize(get_coords_of_empty_rows(symbol_map));
+        benchmark::DoNotOptimize(get_coords_of_empty_columns(symbol_map));
+    }
+    bench::set_throughput(state, input);
+}
+
+void count_all_steps(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Stream stream{input};
+    const auto symbol_map = parse_symbol_map(stream);
+    const auto galaxy_positions = collect_galaxy_positions(symbol_map);
+    const auto coords_of_empty_rows = get_coords_of_empty_rows(symbol_map);
+    const auto coords_of_empty_columns = get_coords_of_empty_columns(symbol_map);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            count_all_steps(galaxy_positions, coords_of_empty_rows, coords_of_empty_columns, 2));
+    }
+    const auto num_of_galaxies = static_cast<std::int64_t>(galaxy_positions.size());
+    state.SetItemsProcessed(state.iterations() * num_of_galaxies * (num_of_galaxies - 1) / 2);
+}
+} // namespace
+
+BENCHMARK(parse_symbol_map)->Arg(1)->Arg(10);
+BENCHMARK(count_all_steps)->Arg(1)->Arg(10);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(10)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(10)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,37 @@
+#include "gen/Generator.hpp"
+#include <vector>
+
+namespace
+{
+// Image with scattered galaxies and a few rows and columns without any, which are the ones to expand.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    constexpr auto empty_line_probability = 0.07;
+    constexpr auto galaxy_probability = 0.02;
+    const auto side = gen::scaled_side(scale, 140);
+    std::vector<bool> is_empty_column(side);
+    for (auto x = 0ull; x < side; ++x)
+    {
+        is_empty_column[x] = gen::chance(random, empty_line_probability);
+    }
+    for (auto y = 0ull; y < side; ++y)
+    {
+        if (y > 0)
+        {
+            output.put('\n');
+        }
+        const auto is_empty_row = gen::chance(random, empty_line_probability);
+        for (auto x = 0ull; x < side; ++x)
+        {
+            const auto is_galaxy = not is_empty_row and not is_empty_column[x]
+                and gen::chance(random, galaxy_probability);
+            output.put(is_galaxy ? '#' : '.');
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
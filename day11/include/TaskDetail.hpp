@@ -0,0 +1,36 @@
+#pragma once
+
+#include "utility/Grid.hpp"
+#include <vector>
+
+namespace utility
+{
+class Stream;
+} // namespace utility
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day11::detail
+{
+struct Vector
+{
+    using Coord = int;
+    Coord x{}, y{};
+};
+
+using SymbolMap = utility::Grid<char>;
+SymbolMap parse_symbol_map(utility::Stream&);
+
+using Positions = std::vector<Vector>;
+Positions collect_galaxy_positions(const SymbolMap&);
+
+using Coords = std::vector<Vector::Coord>;
+Coords get_coords_of_empty_rows(const SymbolMap&);
+Coords get_coords_of_empty_columns(const SymbolMap&);
+
+using ExpansionMultiplier = unsigned;
+unsigned long long count_all_steps(
+    const Positions& galaxy_positions,
+    const Coords& coords_of_empty_rows,
+    const Coords& coords_of_empty_columns,
+    ExpansionMultiplier);
+} // namespace task::day11::detail
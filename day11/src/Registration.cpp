@@ -0,0 +1,8 @@
+#include "Task.hpp"
+#include "utility/Registry.hpp"
+
+namespace
+{
+const utility::SolverRegistration part1{11, 1, task::solve_part1};
+const utility::SolverRegistration part2{11, 2, task::solve_part2};
+} // namespace
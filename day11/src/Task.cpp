@@ -1,47 +1,30 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Grid.hpp"
+#include "utility/Parallel.hpp"
 #include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
+#include <algorithm>
 #include <vector>
-#include <string>
 
-namespace
+namespace task::inline day11::detail
 {
-struct Vector
-{
-    using Coord = int;
-    Coord x{}, y{};
-};
-
-using SymbolMap = std::vector<std::string>;
+constexpr auto empty_symbol = '.';
 
-auto get_size(const SymbolMap& map)
+SymbolMap parse_symbol_map(utility::Stream& stream)
 {
-    if (map.empty())
-    {
-        return Vector{0, 0};
-    }
-    const auto& row = map.front();
-    return Vector{static_cast<int>(row.length()), static_cast<int>(map.size())};
+    TIME_SCOPE("parse_symbol_map");
+    return utility::parse_grid(stream);
 }
 
-auto parse_symbol_map(utility::Stream& stream)
-{
-    SymbolMap map;
-    for (auto line : stream)
-    {
-        map.push_back(std::move(line));
-    }
-    return map;
-}
-
-using Positions = std::vector<Vector>;
-
-auto collect_galaxy_positions(const SymbolMap& map)
+Positions collect_galaxy_positions(const SymbolMap& map)
 {
+    TIME_SCOPE("collect_galaxy_positions");
     Positions galaxy_positions;
-    for (auto y = 0; const auto& line : map)
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        for (auto x = 0; const auto c : line)
+        for (auto x = 0; const auto c : map.get_row(y))
         {
             if (c == '#')
             {
@@ -49,43 +32,43 @@ auto collect_galaxy_positions(const SymbolMap& map)
             }
             ++x;
         }
-        ++y;
     }
     return galaxy_positions;
 }
 
-using Coords = std::vector<Vector::Coord>;
-
-auto get_coords_of_empty_rows(const SymbolMap& map)
+Coords get_coords_of_empty_rows(const SymbolMap& map)
 {
+    TIME_SCOPE("get_coords_of_empty_rows");
     Coords coords;
-    for (std::size_t y{}; const auto& row : map)
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        if (row.find_first_not_of('.') == std::string::npos)
+        if (std::ranges::all_of(map.get_row(y), [](const auto c) { return c == empty_symbol; }))
         {
             coords.push_back(y);
         }
-        ++y;
     }
     return coords;
 }
 
-auto get_coords_of_empty_columns(const SymbolMap& map)
+Coords get_coords_of_empty_columns(const SymbolMap& map)
 {
-    Coords coords;
-    const auto map_size = get_size(map);
-    for (auto x = 0; x < map_size.x; ++x)
+    TIME_SCOPE("get_coords_of_empty_columns");
+    std::vector<bool> is_empty(static_cast<std::size_t>(map.get_width()), true);
+    for (auto y = 0; y < map.get_height(); ++y)
     {
-        auto is_empty = true;
-        for (auto y = 0; y < map_size.y; ++y)
+        for (auto x = 0; const auto c : map.get_row(y))
         {
-            if (map[y][x] != '.')
+            if (c != empty_symbol)
             {
-                is_empty = false;
-                break;
+                is_empty[static_cast<std::size_t>(x)] = false;
             }
+            ++x;
         }
-        if (is_empty)
+    }
+    Coords coords;
+    for (auto x = 0; x < map.get_width(); ++x)
+    {
+        if (is_empty[static_cast<std::size_t>(x)])
         {
             coords.push_back(x);
         }
@@ -108,13 +91,13 @@ auto count_steps_between(const Coords& coords, int first, int last)
     return std::ranges::count_if(coords, is_between);
 }
 
-using ExpansionMultiplier = unsigned;
-auto count_all_steps(
+unsigned long long count_all_steps(
     const Positions& galaxy_positions,
     const Coords& coords_of_empty_rows,
     const Coords& coords_of_empty_columns,
     ExpansionMultiplier multiplier)
 {
+    TIME_SCOPE("count_all_steps");
     auto sum = 0ull;
     for (auto first_itr = galaxy_positions.cbegin(); first_itr != galaxy_positions.cend(); ++first_itr)
     {
@@ -133,10 +116,12 @@ auto count_all_steps(
     }
     return sum;
 }
-} // namespace
+} // namespace task::day11::detail
 
-namespace task
+namespace task::inline day11
 {
+using namespace detail;
+
 Answer solve_part1(utility::Stream& stream)
 {
     const auto symbol_map = parse_symbol_map(stream);
@@ -156,5 +141,19 @@ Answer solve_part2(utility::Stream& stream)
     constexpr ExpansionMultiplier multiplier{1'000'000};
     return count_all_steps(galaxy_positions, coords_of_empty_rows, coords_of_empty_columns, multiplier);
 }
-} // namespace task
+
+Answers solve_both(utility::Stream& stream)
+{
+    const auto symbol_map = parse_symbol_map(stream);
+    const auto galaxy_positions = collect_galaxy_positions(symbol_map);
+    const auto coords_of_empty_rows = get_coords_of_empty_rows(symbol_map);
+    const auto coords_of_empty_columns = get_coords_of_empty_columns(symbol_map);
+    const auto count_steps_with = [&](ExpansionMultiplier multiplier) -> Answer {
+        return count_all_steps(galaxy_positions, coords_of_empty_rows, coords_of_empty_columns, multiplier);
+    };
+    return utility::run_concurrently(
+        [&count_steps_with]() { return count_steps_with(ExpansionMultiplier{2}); },
+        [&count_steps_with]() { return count_steps_with(ExpansionMultiplier{1'000'000}); });
+}
+} // namespace task::day11
 
@@ -0,0 +1,69 @@
+#include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "bench/Bench.hpp"
+#include "utility/Arena.hpp"
+#include "utility/Stream.hpp"
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using bench::solve;
+using task::detail::count_combinations;
+using task::detail::parse_record;
+using task::detail::Record;
+using task::detail::unfold;
+
+constexpr std::string_view example{R"(???.### 1,1,3
+.??..??...?##. 1,1,3
+?#?#?#?#?#?#?#? 1,3,1,6
+????.#...#... 4,1,1
+????.######..#####. 1,6,5
+?###???????? 3,2,1)"};
+
+void parse_record(benchmark::State& state)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    for (auto _ : state)
+    {
+        utility::Stream stream{input};
+        for (const auto line : stream)
+        {
+            benchmark::DoNotOptimize(parse_record(line));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+
+void count_combinations(benchmark::State& state, bool is_unfolded)
+{
+    const auto input = bench::get_input(state, example);
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    std::vector<Record> records;
+    utility::Stream stream{input};
+    for (const auto line : stream)
+    {
+        const auto record = parse_record(line);
+        records.push_back(is_unfolded ? unfold(record) : record);
+    }
+    for (auto _ : state)
+    {
+        for (const auto& record : records)
+        {
+            benchmark::DoNotOptimize(count_combinations(record));
+        }
+    }
+    bench::set_throughput(state, input);
+}
+} // namespace
+
+BENCHMARK(parse_record)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(count_combinations, part1, false)->Arg(1)->Arg(1000);
+BENCHMARK_CAPTURE(count_combinations, part2, true)->Arg(1)->Arg(100);
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(100)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include "gen/Generator.hpp"
+#include <string>
+#include <vector>
+
+namespace
+{
+using Lengths = std::vector<std::uint64_t>;
+
+// Damaged groups which fit into the pattern, each followed by at least one operational spring.
+Lengths create_groups(gen::Random& random, std::uint64_t pattern_length)
+{
+    constexpr auto max_group_count = 6u;
+    constexpr auto max_group_length = 5u;
+    Lengths groups{gen::uniform(random, 1, max_group_length)};
+    auto used_length = groups.front();
+    while (groups.size() < max_group_count)
+    {
+        const auto length = gen::uniform(random, 1, max_group_length);
+        if (used_length + 1 + length > pattern_length)
+        {
+            break;
+        }
+        groups.push_back(length);
+        used_length += 1 + length;
+    }
+    return groups;
+}
+
+std::string create_pattern(gen::Random& random, const Lengths& groups, std::uint64_t pattern_length)
+{
+    Lengths gaps(groups.size() + 1, 0);
+    std::uint64_t used_length{0};
+    for (auto index = 0u; index < groups.size(); ++index)
+    {
+        gaps[index + 1] = index + 1 < groups.size() ? 1 : 0;
+        used_length += groups[index] + gaps[index + 1];
+    }
+    for (; used_length < pattern_length; ++used_length)
+    {
+        ++gaps[gen::uniform(random, 0, gaps.size() - 1)];
+    }
+
+    std::string pattern(gaps.front(), '.');
+    for (auto index = 0u; index < groups.size(); ++index)
+    {
+        pattern.append(groups[index], '#');
+        pattern.append(gaps[index + 1], '.');
+    }
+    return pattern;
+}
+
+// Records with random arrangements, where each spring is unknown with probability 1/2.
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    const auto record_count = gen::scaled(scale, 1000);
+    for (auto record = 0ull; record < record_count; ++record)
+    {
+        if (record > 0)
+        {
+            output.put('\n');
+        }
+        const auto pattern_length = gen::uniform(random, 6, 20);
+        const auto groups = create_groups(random, pattern_length);
+        auto pattern = create_pattern(random, groups, pattern_length);
+        for (auto& spring : pattern)
+        {
+            if (gen::chance(random, 0.5))
+            {
+                spring = '?';
+            }
+        }
+        output.write(pattern);
+        output.put(' ');
+        for (auto index = 0u; index < groups.size(); ++index)
+        {
+            if (index > 0)
+            {
+                output.put(',');
+            }
+            output.write_number(groups[index]);
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Internals of the solution, declared for the benchmarks of its kernels.
+namespace task::inline day12::detail
+{
+using Length = unsigned;
+using Lengths = std::pmr::vector<Length>;
+
+struct Record
+{
+    using Pattern = std::pmr::string;
+    Pattern pattern;
+    Lengths sections;
+};
+
+// Records are allocated from the current arena.
+Record parse_record(std::string_view line);
+Record unfold(const Record&);
+
+using Count = unsigned long long;
+Count count_combinations(const Record&);
+} // namespace task::day12::detail
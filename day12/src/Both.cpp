@@ -0,0 +1,7 @@
+#include "Task.hpp"
+#include "utility/Main.hpp"
+
+int main(int argc, char* argv[])
+{
+    return utility::run(argc, argv, task::solve_both);
+}
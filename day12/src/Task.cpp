@@ -1,52 +1,109 @@
 #include "Task.hpp"
+#include "TaskDetail.hpp"
+#include "utility/Arena.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/Parallel.hpp"
+#include "utility/ParseCache.hpp"
+#include "utility/Scanner.hpp"
 #include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include "utility/Tokenizer.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <numeric>
+#include <optional>
+#include <stdexcept>
 #include <vector>
 #include <string>
-#include <regex>
+#include <string_view>
 
-namespace
+namespace task::inline day12::detail
 {
-using Length = unsigned;
-using Lengths = std::vector<Length>;
+auto parse_sections(std::string_view string)
+{
+    Lengths sections{utility::get_current_resource()};
+    for (const auto length : utility::Integers<Length>{string})
+    {
+        sections.push_back(length);
+    }
+    return sections;
+}
 
-struct Record
+Record parse_record(std::string_view line)
 {
-    using Pattern = std::string;
-    Pattern pattern;
-    Lengths sections;
-};
-using Records = std::vector<Record>;
+    TIME_SCOPE("parse_record");
+    const auto [pattern, sections] = utility::scan<"{s} {s}">(line);
+    return Record{Record::Pattern{pattern, utility::get_current_resource()}, parse_sections(sections)};
+}
 
-auto parse_sections(const std::string& string)
+using Records = std::pmr::vector<Record>;
+
+// Records are cached as their patterns followed by the number of sections of each record and all the sections.
+constexpr utility::ParseCacheKey records_cache_key{"day12-records", 1};
+
+void save_records(utility::ParseCacheWriter& writer, const Records& records)
 {
-    const std::regex number_regex{R"(\d+)"};
-    const std::sregex_iterator numbers_begin{string.cbegin(), string.cend(), number_regex};
-    const std::sregex_iterator numbers_end{};
-    Lengths sections;
-    for (auto numbers_itr = numbers_begin; numbers_itr != numbers_end; ++numbers_itr)
+    std::vector<std::string_view> patterns;
+    std::vector<std::uint32_t> section_counts;
+    std::vector<Length> sections;
+    for (const auto& record : records)
     {
-        sections.push_back(std::stoul(numbers_itr->str()));
+        patterns.push_back(record.pattern);
+        section_counts.push_back(static_cast<std::uint32_t>(record.sections.size()));
+        sections.insert(sections.end(), record.sections.begin(), record.sections.end());
     }
-    return sections;
+    writer.write_strings(patterns);
+    writer.write_array<std::uint32_t>(section_counts);
+    writer.write_array<Length>(sections);
 }
 
-auto parse_records(utility::Stream& stream)
+auto load_records(utility::ParseCacheReader& reader)
 {
-    const std::regex regex{R"((.*?)( )(.*))"};
-    Records records;
-    for (const auto& line : stream)
+    const auto patterns = reader.read_strings();
+    const auto section_counts = reader.read_array<std::uint32_t>();
+    auto sections = reader.read_array<Length>();
+    if (patterns.size() != section_counts.size())
     {
-        std::smatch match;
-        std::regex_search(line, match, regex);
-        auto pattern = match.str(1);
-        auto sections = parse_sections(match.str(3));
-        records.push_back(Record{std::move(pattern), std::move(sections)});
+        throw std::logic_error{"Parse cache is corrupted: records have different numbers of patterns and sections"};
+    }
+    Records records{utility::get_current_resource()};
+    records.reserve(patterns.size());
+    for (auto index = 0u; index < patterns.size(); ++index)
+    {
+        const auto count = section_counts[index];
+        if (count > sections.size())
+        {
+            throw std::logic_error{"Parse cache is corrupted: records exceed their sections"};
+        }
+        const auto record_sections = sections.first(count);
+        records.push_back(Record{
+            Record::Pattern{patterns[index], utility::get_current_resource()},
+            Lengths{record_sections.begin(), record_sections.end(), utility::get_current_resource()}});
+        sections = sections.subspan(count);
     }
     return records;
 }
 
+auto parse_records(utility::Stream& stream)
+{
+    TIME_SCOPE("parse_records");
+    const auto parse = [](utility::Stream& stream) {
+        Records records{utility::get_current_resource()};
+        for (const auto& line : stream)
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            records.push_back(parse_record(line));
+        }
+        return records;
+    };
+    return utility::parse_cached(stream, records_cache_key, parse, save_records, load_records);
+}
+
 using Offset = unsigned;
 struct Range
 {
@@ -58,7 +115,7 @@ struct Group
     Length length;
     Range offset_range;
 };
-using Groups = std::vector<Group>;
+using Groups = std::pmr::vector<Group>;
 
 auto build_groups(const Record& record)
 {
@@ -67,7 +124,7 @@ auto build_groups(const Record& record)
     const auto sum_of_sections = std::accumulate(sections.begin(), sections.end(), Length{0});
     const auto total_length = length_of_gaps + sum_of_sections;
     const auto base_offset = static_cast<Length>(pattern.length()) - total_length;
-    Groups groups;
+    Groups groups{utility::get_current_resource()};
     Offset offset{0u};
     for (auto length : sections)
     {
@@ -97,18 +154,19 @@ auto contains_hash(const Record::Pattern& pattern, const Range& range)
     return contains(pattern, range, '#');
 }
 
-using Count = unsigned long long;
-
 class CombinationCounter
 {
 public:
     CombinationCounter(const Record& record) :
-        record{record}, groups{build_groups(this->record)}, count_cache(this->groups.size(), CountMap{})
+        record{record},
+        groups{build_groups(this->record)},
+        count_cache(this->groups.size(), utility::get_current_resource())
     {
     }
 
     Count count_combinations()
     {
+        TIME_SCOPE("count_combinations");
         if (groups.empty())
         {
             return 0;
@@ -136,8 +194,8 @@ public:
 private:
     const Record& record;
     const Groups groups;
-    using CountMap = std::map<Offset, Count>;
-    using CountCache = std::vector<CountMap>;
+    using CountMap = std::pmr::map<Offset, Count>;
+    using CountCache = std::pmr::vector<CountMap>;
     CountCache count_cache;
     using Index = std::size_t;
 
@@ -196,61 +254,91 @@ private:
         return current_count;
     }
 };
-} // namespace
 
-namespace task
+Count count_combinations(const Record& record)
 {
-Answer solve_part1(utility::Stream& stream)
+    CombinationCounter counter{record};
+    return counter.count_combinations();
+}
+
+// Folds the counts of each record into a single value, parsing the records on the fly unless they are cached, as a
+// cache has to hold all of them.
+template <typename T, typename CountRecord, typename Merge = std::plus<>>
+T reduce_records(utility::Stream& stream, T init, CountRecord count_record, Merge merge = {})
 {
-    const auto records = parse_records(stream);
-    Count sum{0};
-    for (const auto& record : records)
+    if (not utility::is_parse_cache_enabled())
     {
-        CombinationCounter counter{record};
-        sum += counter.count_combinations();
+        return utility::parallel_line_reduce(stream, init, [&count_record](std::string_view line) {
+            return count_record(parse_record(line));
+        }, merge);
     }
-    return sum;
+    const auto records = parse_records(stream);
+    return utility::parallel_reduce(0, records.size(), init, [&records, &count_record](std::size_t index) {
+        return count_record(records[index]);
+    }, merge);
+}
+} // namespace task::day12::detail
+
+namespace task::inline day12
+{
+using namespace detail;
+
+Answer solve_part1(utility::Stream& stream)
+{
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    return reduce_records(stream, Count{0}, [](const Record& record) { return count_combinations(record); });
+}
+
+Answer get_line_term_part1(std::string_view line)
+{
+    return count_combinations(parse_record(line));
 }
-} // namespace task
+} // namespace task::day12
 
-namespace
+namespace task::inline day12::detail
 {
-auto parse_quintuple_records(utility::Stream& stream)
+Record unfold(const Record& record)
 {
+    TIME_SCOPE("unfold");
     constexpr auto num_of_copies = 5u;
     constexpr auto num_of_gaps = 4u;
-    auto records = parse_records(stream);
-    for (auto& record : records)
+    Record::Pattern pattern{record.pattern, utility::get_current_resource()};
+    pattern.reserve((pattern.length() * num_of_copies) + num_of_gaps);
+    Lengths sections{record.sections, utility::get_current_resource()};
+    sections.reserve(sections.size() * num_of_copies);
+    for (auto i = 1u; i < num_of_copies; ++i)
     {
-        auto pattern = record.pattern;
-        pattern.reserve((pattern.length() * num_of_copies) + num_of_gaps);
-        auto sections = record.sections;
-        sections.reserve(sections.size() * num_of_copies);
-        for (auto i = 1u; i < num_of_copies; ++i)
-        {
-            pattern += '?';
-            pattern.append(record.pattern);
-            sections.insert(sections.end(), record.sections.begin(), record.sections.end());
-        }
-        record.pattern = pattern;
-        record.sections = sections;
+        pattern += '?';
+        pattern.append(record.pattern);
+        sections.insert(sections.end(), record.sections.begin(), record.sections.end());
     }
-    return records;
+    return Record{std::move(pattern), std::move(sections)};
 }
-} // namespace
+} // namespace task::day12::detail
 
-namespace task
+namespace task::inline day12
 {
 Answer solve_part2(utility::Stream& stream)
 {
-    const auto records = parse_quintuple_records(stream);
-    Count sum{0};
-    for (const auto& record : records)
-    {
-        CombinationCounter counter{record};
-        sum += counter.count_combinations();
-    }
-    return sum;
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    return reduce_records(stream, Count{0}, [](const Record& record) { return count_combinations(unfold(record)); });
+}
+
+Answers solve_both(utility::Stream& stream)
+{
+    utility::Arena arena{utility::Arena::Mode::pooled};
+    const utility::ArenaScope arena_scope{arena};
+    const auto count_both = [](const Record& record) {
+        return Answers{count_combinations(record), count_combinations(unfold(record))};
+    };
+    return reduce_records(stream, Answers{}, count_both, utility::PairPlus{});
+}
+
+Answer get_line_term_part2(std::string_view line)
+{
+    return count_combinations(unfold(parse_record(line)));
 }
-} // namespace task
+} // namespace task::day12
 
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "utility/Arguments.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace gen
+{
+using Random = std::mt19937_64;
+
+// Buffered writer of the generated input to stdout, so that inputs larger than memory can be produced.
+class Output
+{
+public:
+    Output() = default;
+
+    Output(const Output&) = delete;
+
+    Output& operator=(const Output&) = delete;
+
+    ~Output()
+    {
+        flush();
+    }
+
+    void put(char c)
+    {
+        if (size == buffer.size())
+        {
+            flush();
+        }
+        buffer[size++] = c;
+    }
+
+    void write(std::string_view string)
+    {
+        while (not string.empty())
+        {
+            if (size == buffer.size())
+            {
+                flush();
+            }
+            const auto length = std::min(string.size(), buffer.size() - size);
+            std::memcpy(buffer.data() + size, string.data(), length);
+            size += length;
+            string.remove_prefix(length);
+        }
+    }
+
+    template <std::integral T>
+    void write_number(T value)
+    {
+        std::array<char, 24> digits;
+        const auto [end, _] = std::to_chars(digits.begin(), digits.end(), value);
+        write(std::string_view{digits.begin(), end});
+    }
+
+    // Writes the number right-aligned in a field of the given width.
+    template <std::integral T>
+    void write_number(T value, std::size_t width)
+    {
+        std::array<char, 24> digits;
+        const auto [end, _] = std::to_chars(digits.begin(), digits.end(), value);
+        const auto length = static_cast<std::size_t>(end - digits.begin());
+        for (auto i = length; i < width; ++i)
+        {
+            put(' ');
+        }
+        write(std::string_view{digits.begin(), end});
+    }
+
+    void flush()
+    {
+        std::fwrite(buffer.data(), 1, size, stdout);
+        size = 0;
+    }
+
+private:
+    std::array<char, 64 * 1024> buffer;
+    std::size_t size{0};
+};
+
+inline std::uint64_t uniform(Random& random, std::uint64_t min, std::uint64_t max)
+{
+    return std::uniform_int_distribution<std::uint64_t>{min, max}(random);
+}
+
+inline bool chance(Random& random, double probability)
+{
+    return std::bernoulli_distribution{probability}(random);
+}
+
+template <typename Container>
+const auto& pick(Random& random, const Container& container)
+{
+    return container[uniform(random, 0, std::size(container) - 1)];
+}
+
+// Count of something which appears `count` times in an input of scale 1.
+inline std::uint64_t scaled(double scale, std::uint64_t count)
+{
+    return std::max<std::uint64_t>(1, std::llround(scale * static_cast<double>(count)));
+}
+
+// Side of a square grid whose area grows with the scale.
+inline std::uint64_t scaled_side(double scale, std::uint64_t side)
+{
+    return std::max<std::uint64_t>(1, std::llround(std::sqrt(scale) * static_cast<double>(side)));
+}
+
+// Body of every generator executable, called as `gen <scale> [seed]`. Scale 1 corresponds to the size of a puzzle
+// input and the same scale and seed always produce the same input.
+template <typename Generate>
+int run(int argc, char* argv[], Generate&& generate)
+{
+    try
+    {
+        const auto args = utility::parse_arguments(argc, argv);
+        if (args.size() < 2)
+        {
+            throw std::invalid_argument{"No scale provided"};
+        }
+        const auto scale = std::stod(args[1]);
+        if (not (scale > 0.0))
+        {
+            throw std::invalid_argument{"Scale must be positive"};
+        }
+        constexpr auto default_seed = 2023u;
+        Random random{args.size() > 2 ? std::stoull(args[2]) : default_seed};
+        Output output;
+        generate(output, random, scale);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+} // namespace gen
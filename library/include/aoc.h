@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+
+// C interface of the solvers, for solving inputs held in memory without running the part executables. Every
+// function may be called from several threads at once and none of them writes to stdout or stderr.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Incremented whenever a function or type of this header changes incompatibly.
+#define AOC_ABI_VERSION 1
+
+typedef enum aoc_status
+{
+    AOC_OK = 0,
+    AOC_INVALID_ARGUMENT = 1,
+    AOC_UNKNOWN_SOLVER = 2,
+    AOC_SOLVE_FAILED = 3,
+} aoc_status;
+
+// Answer of a part. When solving fails the error holds the reason, truncated to fit, and is empty otherwise.
+typedef struct aoc_answer
+{
+    unsigned long long value;
+    char error[256];
+} aoc_answer;
+
+// Version of the interface implemented by the loaded library, to be compared with AOC_ABI_VERSION.
+unsigned aoc_abi_version(void);
+
+// Solves the part of the day on the `length` bytes of input at `buffer`, which is neither copied nor modified.
+aoc_status aoc_solve(unsigned day, unsigned part, const char* buffer, size_t length, aoc_answer* answer);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,59 @@
+#include "aoc.h"
+#include "utility/Registry.hpp"
+#include "utility/Stream.hpp"
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <string_view>
+
+namespace
+{
+aoc_status fail(aoc_answer& answer, aoc_status status, std::string_view error)
+{
+    const auto length = std::min(error.size(), sizeof(answer.error) - 1);
+    std::copy_n(error.begin(), length, answer.error);
+    answer.error[length] = '\0';
+    return status;
+}
+} // namespace
+
+unsigned aoc_abi_version(void)
+{
+    return AOC_ABI_VERSION;
+}
+
+// Solvers keep their state on the stack and in arenas of their own, so concurrent calls share only the read-only
+// registry and the thread pool. Exceptions never cross the interface.
+aoc_status aoc_solve(unsigned day, unsigned part, const char* buffer, size_t length, aoc_answer* answer)
+{
+    if (answer == nullptr)
+    {
+        return AOC_INVALID_ARGUMENT;
+    }
+    *answer = aoc_answer{};
+    if (buffer == nullptr and length > 0)
+    {
+        return fail(*answer, AOC_INVALID_ARGUMENT, "Input buffer is null");
+    }
+    try
+    {
+        const auto& solvers = utility::get_solvers();
+        const auto solver_itr = solvers.find(utility::SolverId{day, part});
+        if (solver_itr == solvers.end())
+        {
+            return fail(*answer, AOC_UNKNOWN_SOLVER,
+                "No solver for day " + std::to_string(day) + " part " + std::to_string(part));
+        }
+        utility::Stream stream{std::string_view{buffer, length}};
+        answer->value = solver_itr->second(stream);
+        return AOC_OK;
+    }
+    catch (const std::exception& e)
+    {
+        return fail(*answer, AOC_SOLVE_FAILED, e.what());
+    }
+    catch (...)
+    {
+        return fail(*answer, AOC_SOLVE_FAILED, "Unknown exception");
+    }
+}
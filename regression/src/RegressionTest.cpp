@@ -0,0 +1,140 @@
+#include "utility/Registry.hpp"
+#include "utility/Stream.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+struct Case
+{
+    unsigned day, part;
+    std::string_view input_name;
+    utility::SolverAnswer answer;
+};
+
+std::ostream& operator<<(std::ostream& stream, const Case& c)
+{
+    return stream << "d" << c.day << "p" << c.part << " on " << c.input_name;
+}
+
+// Example inputs of the puzzles, stored with a newline at the end like the real inputs.
+const std::vector<Case> cases{
+    {1, 1, "day01-part1.txt", 142},
+    {1, 2, "day01-part2.txt", 281},
+    {2, 1, "day02.txt", 8},
+    {2, 2, "day02.txt", 2286},
+    {3, 1, "day03.txt", 4361},
+    {3, 2, "day03.txt", 467835},
+    {4, 1, "day04.txt", 13},
+    {4, 2, "day04.txt", 30},
+    {5, 1, "day05.txt", 35},
+    {5, 2, "day05.txt", 46},
+    {6, 1, "day06.txt", 288},
+    {6, 2, "day06.txt", 71503},
+    {7, 1, "day07.txt", 6440},
+    {7, 2, "day07.txt", 5905},
+    {8, 1, "day08-part1.txt", 2},
+    {8, 2, "day08-part2.txt", 6},
+    {9, 1, "day09.txt", 114},
+    {9, 2, "day09.txt", 2},
+    {10, 1, "day10-part1.txt", 8},
+    {10, 2, "day10-part2.txt", 4},
+    {11, 1, "day11.txt", 374},
+    {11, 2, "day11.txt", 82000210},
+    {12, 1, "day12.txt", 21},
+    {12, 2, "day12.txt", 525152},
+};
+
+std::string read_input(std::string_view name)
+{
+    const auto path = std::filesystem::path{AOC_REGRESSION_INPUTS} / name;
+    std::ifstream file{path, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+std::string to_crlf(std::string_view text)
+{
+    std::string converted;
+    for (const auto c : text)
+    {
+        if (c == '\n')
+        {
+            converted.push_back('\r');
+        }
+        converted.push_back(c);
+    }
+    return converted;
+}
+
+utility::SolverAnswer solve(const Case& c, std::string_view text)
+{
+    utility::Stream stream{text};
+    return utility::get_solvers().at(utility::SolverId{c.day, c.part})(stream);
+}
+
+class RegressionTest : public testing::TestWithParam<Case>
+{
+protected:
+    void SetUp() override
+    {
+        input = read_input(GetParam().input_name);
+        ASSERT_TRUE(input.ends_with('\n')) << GetParam().input_name << " should end with a newline";
+    }
+
+    std::string input;
+};
+
+TEST_P(RegressionTest, SolvesInputEndingWithNewline)
+{
+    EXPECT_EQ(solve(GetParam(), input), GetParam().answer);
+}
+
+TEST_P(RegressionTest, SolvesInputWithoutFinalNewline)
+{
+    EXPECT_EQ(solve(GetParam(), std::string_view{input}.substr(0, input.size() - 1)), GetParam().answer);
+}
+
+TEST_P(RegressionTest, SolvesInputWithCrlfLineEndings)
+{
+    EXPECT_EQ(solve(GetParam(), to_crlf(input)), GetParam().answer);
+}
+
+TEST_P(RegressionTest, SolvesInputReadThroughIstream)
+{
+    std::istringstream text{input};
+    utility::Stream stream{text};
+    const auto& c = GetParam();
+    EXPECT_EQ(utility::get_solvers().at(utility::SolverId{c.day, c.part})(stream), c.answer);
+}
+
+// Line terms are what aoc-watch sums, over the lines the stream hands out.
+TEST_P(RegressionTest, LineTermsSumToAnswer)
+{
+    const auto& c = GetParam();
+    const auto& line_terms = utility::get_line_terms();
+    const auto line_term_itr = line_terms.find(utility::SolverId{c.day, c.part});
+    if (line_term_itr == line_terms.end())
+    {
+        GTEST_SKIP() << "No line term registered";
+    }
+    utility::Stream stream{std::string_view{input}};
+    utility::SolverAnswer sum{0};
+    for (const auto& line : stream)
+    {
+        if (not line.empty())
+        {
+            sum += line_term_itr->second(line);
+        }
+    }
+    EXPECT_EQ(sum, c.answer);
+}
+
+INSTANTIATE_TEST_SUITE_P(Examples, RegressionTest, testing::ValuesIn(cases));
+} // namespace
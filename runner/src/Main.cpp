@@ -0,0 +1,191 @@
+#include "utility/Arguments.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/MappedFile.hpp"
+#include "utility/ParseCache.hpp"
+#include "utility/Registry.hpp"
+#include "utility/Scanner.hpp"
+#include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Job
+{
+    std::string name;
+    utility::SolverId id;
+    const utility::Solver* solver;
+    std::string input_filename;
+};
+using Jobs = std::vector<Job>;
+
+struct Result
+{
+    std::optional<utility::SolverAnswer> answer;
+    std::string error;
+    Clock::duration time;
+};
+using Results = std::vector<Result>;
+
+std::string get_day_name(unsigned day)
+{
+    return (day < 10 ? "day0" : "day") + std::to_string(day);
+}
+
+// Selects solvers named like the part targets, "d03p2", or whole days, "d03". Without a selection all are run.
+std::vector<utility::SolverId> select_solvers(const utility::Arguments& args)
+{
+    const auto& solvers = utility::get_solvers();
+    const auto is_selection = [](std::string_view argument) { return not argument.starts_with("--"); };
+    std::vector<utility::SolverId> selected;
+    for (const std::string_view selection : args | std::views::drop(1) | std::views::filter(is_selection))
+    {
+        const auto is_whole_day = selection.find('p') == std::string_view::npos;
+        const auto [day, part] = is_whole_day
+            ? std::pair{std::get<0>(utility::scan<"d{u}">(selection)), 0ul}
+            : utility::scan<"d{u}p{u}">(selection);
+        const auto is_match = [day, part, is_whole_day](const utility::SolverId& id) {
+            return id.day == day and (is_whole_day or id.part == part);
+        };
+        const auto size_before = selected.size();
+        std::ranges::copy(std::views::keys(solvers) | std::views::filter(is_match), std::back_inserter(selected));
+        if (selected.size() == size_before)
+        {
+            throw std::invalid_argument{CONCAT("No solver matches ", std::quoted(selection))};
+        }
+    }
+    if (selected.empty())
+    {
+        std::ranges::copy(std::views::keys(solvers), std::back_inserter(selected));
+    }
+    return selected;
+}
+
+Jobs create_jobs(const utility::Arguments& args)
+{
+    const auto input_dir = utility::get_option(args, "inputs").value_or(".");
+    Jobs jobs;
+    for (const auto& id : select_solvers(args))
+    {
+        const auto input_filename = input_dir + "/" + get_day_name(id.day) + "/input.txt";
+        const auto name = "d" + get_day_name(id.day).substr(3) + "p" + std::to_string(id.part);
+        jobs.push_back(Job{name, id, &utility::get_solvers().at(id), input_filename});
+    }
+    return jobs;
+}
+
+void set_thread_count(const utility::Arguments& args)
+{
+    if (const auto option = utility::get_option(args, "threads"); option.has_value())
+    {
+        const auto [count] = utility::scan<"{u}">(*option);
+        utility::ThreadPool::set_default_thread_count(static_cast<unsigned>(count));
+    }
+}
+
+Result run_job(const Job& job)
+{
+    Result result;
+    const auto start = Clock::now();
+    try
+    {
+        const auto input_file = utility::map_file(job.input_filename);
+        utility::Stream stream{input_file.get_contents()};
+        result.answer = (*job.solver)(stream);
+    }
+    catch (const std::exception& e)
+    {
+        result.error = e.what();
+    }
+    const auto end = Clock::now();
+    result.time = end - start;
+    if (utility::is_tracing_enabled())
+    {
+        utility::record_trace_event(job.name, start, end);
+    }
+    return result;
+}
+
+// Runs each job as a separate task of the default thread pool, which the solutions share for their own parallel
+// parts.
+Results run_jobs(const Jobs& jobs)
+{
+    Results results(jobs.size());
+    constexpr auto job_per_task = 1u;
+    utility::parallel_for(0, jobs.size(), [&jobs, &results](std::size_t index) {
+        results[index] = run_job(jobs[index]);
+    }, job_per_task);
+    return results;
+}
+
+double to_milliseconds(Clock::duration time)
+{
+    return std::chrono::duration<double, std::milli>{time}.count();
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const auto args = utility::parse_arguments(argc, argv);
+        const auto trace_filename = utility::get_option(args, "trace");
+        utility::set_tracing_enabled(trace_filename.has_value());
+        set_thread_count(args);
+        if (const auto directory = utility::get_option(args, "parse-cache"); directory.has_value())
+        {
+            utility::enable_parse_cache(
+                directory->empty() ? utility::get_default_parse_cache_directory() : std::filesystem::path{*directory});
+        }
+        const auto jobs = create_jobs(args);
+        const auto thread_count = utility::ThreadPool::get_default().get_thread_count();
+
+        const auto start = Clock::now();
+        const auto results = run_jobs(jobs);
+        const auto total_time = Clock::now() - start;
+
+        auto has_failed = false;
+        std::cout << std::fixed << std::setprecision(3);
+        for (auto index = 0u; index < jobs.size(); ++index)
+        {
+            const auto& [name, id, _, input_filename] = jobs[index];
+            const auto& result = results[index];
+            std::cout << get_day_name(id.day) << " part" << id.part << ": ";
+            if (result.answer.has_value())
+            {
+                std::cout << *result.answer;
+            }
+            else
+            {
+                std::cout << "error: " << result.error;
+                has_failed = true;
+            }
+            std::cout << " (" << to_milliseconds(result.time) << " ms)\n";
+        }
+        std::cout << "total: " << to_milliseconds(total_time) << " ms on " << thread_count << " threads" << std::endl;
+        if (trace_filename.has_value())
+        {
+            utility::write_trace(*trace_filename);
+        }
+        return has_failed ? 1 : 0;
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Requests are single lines naming the solver, like the part targets, and where its input is:
+//   d03p2 path /absolute/path/to/input.txt
+//   d03p2 inline <size>
+// An inline request is followed by `size` bytes of input. Each request is answered by a single line, either
+// `answer <value>` or `error <message>`. A connection may carry any number of requests one after another.
+namespace server
+{
+// `aoc.sock` in $XDG_RUNTIME_DIR, or in a directory of the user in the temporary directory when it is not set. The
+// server creates that directory with access for the user only.
+std::filesystem::path get_default_socket_path();
+
+// Socket which reads lines and blocks of bytes through a buffer. The socket is closed on destruction.
+class Connection
+{
+public:
+    explicit Connection(int fd);
+
+    Connection(const Connection&) = delete;
+
+    Connection(Connection&&) noexcept;
+
+    Connection& operator=(const Connection&) = delete;
+
+    ~Connection();
+
+    // Next line without its newline, or nothing when the peer has closed the connection.
+    std::optional<std::string> read_line();
+
+    // Replaces the contents of the string with the next `size` bytes, reusing its capacity.
+    void read_bytes(std::string&, std::size_t size);
+
+    void write(std::string_view);
+
+private:
+    int fd;
+    std::vector<char> buffer;
+    std::size_t begin, end;
+
+    bool fill();
+};
+
+// Connects to the socket of a running server.
+Connection connect(const std::filesystem::path& socket_path);
+
+// Text of an error message on a single line.
+std::string to_single_line(std::string_view);
+} // namespace server
@@ -0,0 +1,103 @@
+#include "Protocol.hpp"
+#include "utility/Arguments.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/MappedFile.hpp"
+#include "utility/Scanner.hpp"
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+// Solvers of the part of the day as the server names them, like `d03p2` for `day03 part2`, or both parts for `both`.
+std::vector<std::string> get_solver_names(std::string_view day_name, std::string_view part_name)
+{
+    utility::scan<"day{u}">(day_name);
+    const auto prefix = "d" + std::string{day_name.substr(3)} + "p";
+    if (part_name == "both")
+    {
+        return {prefix + "1", prefix + "2"};
+    }
+    const auto [part] = utility::scan<"part{u}">(part_name);
+    return {prefix + std::to_string(part)};
+}
+
+// Answer of the solver to the input file.
+std::string solve(
+    server::Connection& connection,
+    const std::string& solver_name,
+    const std::filesystem::path& input_path,
+    bool is_inline)
+{
+    if (is_inline)
+    {
+        const auto input_file = utility::map_file(input_path.string());
+        const auto input = input_file.get_contents();
+        connection.write(solver_name + " inline " + std::to_string(input.size()) + "\n");
+        connection.write(input);
+    }
+    else
+    {
+        connection.write(solver_name + " path " + input_path.string() + "\n");
+    }
+
+    const auto response = connection.read_line();
+    if (not response.has_value())
+    {
+        throw std::logic_error{"Server closed the connection without an answer"};
+    }
+    const std::string_view answer_prefix{"answer "};
+    if (not response->starts_with(answer_prefix))
+    {
+        throw std::logic_error{"Server failed: " + response->substr(response->find(' ') + 1)};
+    }
+    return response->substr(answer_prefix.size());
+}
+} // namespace
+
+// Asks a running `aoc-server` to solve an input file, with the arguments of the `run` script, as
+// `aoc-client day03 part2 [input file]` or `aoc-client day03 both`, and prints the answers like the part executables
+// do. The input file is `input.txt` in the directory of the day by default. The server reads the file itself, unless
+// `--inline` sends its contents instead.
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const auto args = utility::parse_arguments(argc, argv);
+        const auto is_positional = [](std::string_view argument) { return not argument.starts_with("--"); };
+        auto positional_view = args | std::views::drop(1) | std::views::filter(is_positional);
+        const std::vector<std::string> positional_args{positional_view.begin(), positional_view.end()};
+        if (positional_args.size() < 2 or positional_args.size() > 3)
+        {
+            throw std::invalid_argument{
+                "Usage: aoc-client <dayNN> <partN|both> [input file] [--socket=<path>] [--inline]"};
+        }
+        const auto& day_name = positional_args[0];
+        const auto solver_names = get_solver_names(day_name, positional_args[1]);
+        const auto input_path = std::filesystem::absolute(
+            positional_args.size() == 3 ? std::filesystem::path{positional_args[2]}
+                                        : std::filesystem::path{day_name} / "input.txt");
+        const auto socket_path = std::filesystem::path{
+            utility::get_option(args, "socket").value_or(server::get_default_socket_path().string())};
+        const auto is_inline = utility::get_option(args, "inline").has_value();
+
+        // Both parts are requested one after another on the same connection.
+        auto connection = server::connect(socket_path);
+        for (const auto& solver_name : solver_names)
+        {
+            const auto answer = solve(connection, solver_name, input_path, is_inline);
+            std::cout << solver_name << " answer:" << answer << std::endl;
+        }
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "Protocol.hpp"
+#include "utility/Dbg.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace server
+{
+std::filesystem::path get_default_socket_path()
+{
+    // XDG_RUNTIME_DIR is ignored unless it is absolute, as the base directory specification demands.
+    if (const auto* runtime_directory = std::getenv("XDG_RUNTIME_DIR");
+        runtime_directory != nullptr and runtime_directory[0] == '/')
+    {
+        return std::filesystem::path{runtime_directory} / "aoc.sock";
+    }
+    return std::filesystem::temp_directory_path() / ("aoc-" + std::to_string(::getuid())) / "aoc.sock";
+}
+
+Connection::Connection(int fd) : fd{fd}, buffer(64 * 1024), begin{0}, end{0}
+{
+}
+
+Connection::Connection(Connection&& other) noexcept
+    : fd{std::exchange(other.fd, -1)}, buffer{std::move(other.buffer)}, begin{other.begin}, end{other.end}
+{
+}
+
+Connection::~Connection()
+{
+    if (fd >= 0)
+    {
+        ::close(fd);
+    }
+}
+
+std::optional<std::string> Connection::read_line()
+{
+    std::string line;
+    while (true)
+    {
+        const auto* first = buffer.data() + begin;
+        const auto* last = buffer.data() + end;
+        const auto* newline = std::find(first, last, '\n');
+        line.append(first, newline);
+        if (newline != last)
+        {
+            begin += static_cast<std::size_t>(newline - first) + 1;
+            return line;
+        }
+        begin = end;
+        if (not fill())
+        {
+            if (not line.empty())
+            {
+                throw std::logic_error{"Connection closed in the middle of a line"};
+            }
+            return std::nullopt;
+        }
+    }
+}
+
+void Connection::read_bytes(std::string& bytes, std::size_t size)
+{
+    bytes.clear();
+    bytes.reserve(size);
+    while (bytes.size() < size)
+    {
+        if (begin == end and not fill())
+        {
+            throw std::logic_error{CONCAT("Connection closed after ", bytes.size(), " of ", size, " bytes")};
+        }
+        const auto length = std::min(size - bytes.size(), end - begin);
+        bytes.append(buffer.data() + begin, length);
+        begin += length;
+    }
+}
+
+void Connection::write(std::string_view bytes)
+{
+    while (not bytes.empty())
+    {
+        const auto written = ::send(fd, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::logic_error{CONCAT("Connection could not be written: ", std::strerror(errno))};
+        }
+        bytes.remove_prefix(static_cast<std::size_t>(written));
+    }
+}
+
+bool Connection::fill()
+{
+    while (true)
+    {
+        const auto received = ::recv(fd, buffer.data(), buffer.size(), 0);
+        if (received < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::logic_error{CONCAT("Connection could not be read: ", std::strerror(errno))};
+        }
+        begin = 0;
+        end = static_cast<std::size_t>(received);
+        return received > 0;
+    }
+}
+
+Connection connect(const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const auto path = socket_path.string();
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        throw std::invalid_argument{CONCAT("Socket path ", path, " is too long")};
+    }
+    std::copy(path.begin(), path.end(), address.sun_path);
+
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        throw std::logic_error{CONCAT("Socket could not be created: ", std::strerror(errno))};
+    }
+    Connection connection{fd};
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        throw std::logic_error{CONCAT("Server at ", path, " could not be reached: ", std::strerror(errno))};
+    }
+    return connection;
+}
+
+std::string to_single_line(std::string_view text)
+{
+    std::string line{text};
+    std::ranges::replace(line, '\n', ' ');
+    return line;
+}
+} // namespace server
@@ -0,0 +1,358 @@
+#include "Protocol.hpp"
+#include "utility/Arguments.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/MappedFile.hpp"
+#include "utility/Registry.hpp"
+#include "utility/Scanner.hpp"
+#include "utility/Stream.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+// Accepted connections waiting for a worker, and the ones being served, so that stopping can interrupt them.
+class ConnectionQueue
+{
+public:
+    void push(int fd)
+    {
+        {
+            const std::lock_guard lock{mutex};
+            fds.push_back(fd);
+        }
+        condition.notify_one();
+    }
+
+    // Next connection to serve, which counts as served until `finish` is called before closing it.
+    std::optional<int> pop(std::stop_token stop_token)
+    {
+        std::unique_lock lock{mutex};
+        if (not condition.wait(lock, stop_token, [this] { return not fds.empty(); }))
+        {
+            return std::nullopt;
+        }
+        const auto fd = fds.front();
+        fds.pop_front();
+        served_fds.push_back(fd);
+        return fd;
+    }
+
+    void finish(int fd)
+    {
+        const std::lock_guard lock{mutex};
+        std::erase(served_fds, fd);
+    }
+
+    // Closes the connections no worker has taken and shuts down the served ones, so that workers waiting for their
+    // next request return.
+    void stop()
+    {
+        const std::lock_guard lock{mutex};
+        for (const auto fd : fds)
+        {
+            ::close(fd);
+        }
+        fds.clear();
+        for (const auto fd : served_fds)
+        {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable_any condition;
+    std::deque<int> fds;
+    std::vector<int> served_fds;
+};
+
+const utility::Solver& find_solver(std::string_view name)
+{
+    const auto [day, part] = utility::scan<"d{u}p{u}">(name);
+    const auto& solvers = utility::get_solvers();
+    const auto solver_itr = solvers.find(utility::SolverId{static_cast<unsigned>(day), static_cast<unsigned>(part)});
+    if (solver_itr == solvers.end())
+    {
+        throw std::invalid_argument{CONCAT("No solver named ", std::quoted(name))};
+    }
+    return solver_itr->second;
+}
+
+// Solves a request read from the connection. Inline inputs are received into the payload buffer of the worker.
+utility::SolverAnswer solve_request(std::string_view request, server::Connection& connection, std::string& payload)
+{
+    const auto [solver_name, kind, argument] = utility::scan<"{s} {s} {s}">(request);
+    const auto& solver = find_solver(solver_name);
+    if (kind == "path")
+    {
+        const auto input_file = utility::map_file(std::string{argument});
+        utility::Stream stream{input_file.get_contents()};
+        return solver(stream);
+    }
+    if (kind == "inline")
+    {
+        const auto [size] = utility::scan<"{u}">(argument);
+        connection.read_bytes(payload, size);
+        utility::Stream stream{std::string_view{payload}};
+        return solver(stream);
+    }
+    throw std::invalid_argument{CONCAT("Unknown input kind ", std::quoted(kind))};
+}
+
+void serve_connection(server::Connection& connection, std::string& payload)
+{
+    try
+    {
+        while (const auto request = connection.read_line())
+        {
+            std::string response;
+            try
+            {
+                response = "answer " + std::to_string(solve_request(*request, connection, payload)) + "\n";
+            }
+            catch (const std::exception& e)
+            {
+                response = "error " + server::to_single_line(e.what()) + "\n";
+            }
+            connection.write(response);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Connection dropped: ", e.what());
+    }
+}
+
+// Workers live as long as the server, so their allocator caches and payload buffers stay warm between requests.
+// Parallel parts of the solutions run on the default thread pool, shared by all workers.
+std::vector<std::jthread> start_workers(unsigned count, ConnectionQueue& queue)
+{
+    std::vector<std::jthread> workers;
+    for (auto index = 0u; index < count; ++index)
+    {
+        workers.emplace_back([&queue](std::stop_token stop_token) {
+            std::string payload;
+            while (const auto fd = queue.pop(stop_token))
+            {
+                server::Connection connection{*fd};
+                serve_connection(connection, payload);
+                queue.finish(*fd);
+            }
+        });
+    }
+    return workers;
+}
+
+// Creates the directory with access for the user only when it is missing, and refuses one which others could write to,
+// as they could replace the socket in it.
+void create_private_directory(const std::filesystem::path& directory)
+{
+    if (::mkdir(directory.c_str(), 0700) != 0 and errno != EEXIST)
+    {
+        const auto message = std::strerror(errno);
+        throw std::logic_error{CONCAT("Directory ", directory.string(), " could not be created: ", message)};
+    }
+    struct stat status;
+    if (::lstat(directory.c_str(), &status) != 0
+        or not S_ISDIR(status.st_mode)
+        or status.st_uid != ::getuid()
+        or (status.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+    {
+        throw std::logic_error{CONCAT("Directory ", directory.string(), " is not private to the user")};
+    }
+}
+
+// Whether a server accepts connections on the socket. The socket of a server which has exited refuses them.
+bool is_served(const std::filesystem::path& socket_path)
+{
+    try
+    {
+        server::connect(socket_path);
+        return true;
+    }
+    catch (const std::logic_error&)
+    {
+        return false;
+    }
+}
+
+// Removes the socket left behind by a server which has exited, but neither a running server's socket nor anything
+// else at the path.
+void remove_stale_socket(const std::filesystem::path& socket_path)
+{
+    struct stat status;
+    if (::lstat(socket_path.c_str(), &status) != 0)
+    {
+        return;
+    }
+    if (not S_ISSOCK(status.st_mode))
+    {
+        throw std::logic_error{CONCAT("Path ", socket_path.string(), " exists and is not a socket")};
+    }
+    if (is_served(socket_path))
+    {
+        throw std::logic_error{CONCAT("Another server is listening on ", socket_path.string())};
+    }
+    std::filesystem::remove(socket_path);
+}
+
+int listen_on(const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const auto path = socket_path.string();
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        throw std::invalid_argument{CONCAT("Socket path ", path, " is too long")};
+    }
+    std::copy(path.begin(), path.end(), address.sun_path);
+    remove_stale_socket(socket_path);
+
+    // Non-blocking, so that a connection aborted between polling and accepting does not block the server.
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        throw std::logic_error{CONCAT("Socket could not be created: ", std::strerror(errno))};
+    }
+    // Only the user may connect. The mask is set around binding, which creates the socket, before any other thread
+    // is started.
+    const auto mask = ::umask(0077);
+    const auto is_bound = ::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    ::umask(mask);
+    constexpr auto backlog = 64;
+    if (not is_bound or ::listen(fd, backlog) != 0)
+    {
+        ::close(fd);
+        throw std::logic_error{CONCAT("Socket ", path, " could not be listened on: ", std::strerror(errno))};
+    }
+    return fd;
+}
+
+// Blocks SIGINT and SIGTERM in the calling thread and in every thread started afterwards, and returns a descriptor
+// which becomes readable once one of them is pending.
+int block_stop_signals()
+{
+    sigset_t signals;
+    ::sigemptyset(&signals);
+    ::sigaddset(&signals, SIGINT);
+    ::sigaddset(&signals, SIGTERM);
+    if (const auto result = ::pthread_sigmask(SIG_BLOCK, &signals, nullptr); result != 0)
+    {
+        throw std::logic_error{CONCAT("Signals could not be blocked: ", std::strerror(result))};
+    }
+    const auto fd = ::signalfd(-1, &signals, SFD_CLOEXEC);
+    if (fd < 0)
+    {
+        throw std::logic_error{CONCAT("Signal descriptor could not be created: ", std::strerror(errno))};
+    }
+    return fd;
+}
+
+// Accepts connections until a stop signal is pending.
+void accept_connections(int listen_fd, int signal_fd, ConnectionQueue& queue)
+{
+    std::array<pollfd, 2> poll_fds{{{listen_fd, POLLIN, 0}, {signal_fd, POLLIN, 0}}};
+    while (true)
+    {
+        if (::poll(poll_fds.data(), poll_fds.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::logic_error{CONCAT("Sockets could not be polled: ", std::strerror(errno))};
+        }
+        if (poll_fds[1].revents != 0)
+        {
+            return;
+        }
+        const auto fd = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno == EINTR or errno == ECONNABORTED or errno == EAGAIN or errno == EWOULDBLOCK)
+            {
+                continue;
+            }
+            throw std::logic_error{CONCAT("Connection could not be accepted: ", std::strerror(errno))};
+        }
+        queue.push(fd);
+    }
+}
+} // namespace
+
+// Serves the solvers linked into the executable on a Unix domain socket until interrupted. Connections are served
+// by `--workers` long-lived threads, the number of hardware threads by default.
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // Before any thread is started, so that none of them is interrupted by the signals.
+        const auto signal_fd = block_stop_signals();
+        const auto args = utility::parse_arguments(argc, argv);
+        const auto socket_option = utility::get_option(args, "socket");
+        const auto socket_path = socket_option.has_value() ? std::filesystem::path{*socket_option}
+                                                           : server::get_default_socket_path();
+        if (not socket_option.has_value())
+        {
+            create_private_directory(socket_path.parent_path());
+        }
+        const auto worker_count = [&args] {
+            if (const auto option = utility::get_option(args, "workers"); option.has_value())
+            {
+                const auto [count] = utility::scan<"{u}">(*option);
+                return static_cast<unsigned>(count);
+            }
+            return std::max(1u, std::thread::hardware_concurrency());
+        }();
+        if (worker_count == 0)
+        {
+            throw std::invalid_argument{"At least one worker is needed"};
+        }
+
+        const auto listen_fd = listen_on(socket_path);
+        ConnectionQueue queue;
+        auto workers = start_workers(worker_count, queue);
+        std::cout << "Serving " << utility::get_solvers().size() << " solvers on " << socket_path.string()
+                  << " with " << worker_count << " workers" << std::endl;
+
+        accept_connections(listen_fd, signal_fd, queue);
+
+        ::close(listen_fd);
+        std::filesystem::remove(socket_path);
+        for (auto& worker : workers)
+        {
+            worker.request_stop();
+        }
+        queue.stop();
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include "utility/Arguments.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Scanner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Target
+{
+    std::filesystem::path generator, part;
+};
+
+// Executables of the selected part and of its day's generator, which are built next to this one.
+Target find_target(const utility::Arguments& args)
+{
+    const auto is_selection = [](std::string_view argument) { return not argument.starts_with("--"); };
+    const auto selection_itr = std::find_if(args.begin() + 1, args.end(), is_selection);
+    if (selection_itr == args.end())
+    {
+        throw std::invalid_argument{"No part selected, expected for example d03p2"};
+    }
+    const auto [day, part] = utility::scan<"d{u}p{u}">(*selection_itr);
+    const auto bin_dir = std::filesystem::canonical("/proc/self/exe").parent_path();
+    const auto day_dir = bin_dir / ((day < 10 ? "day0" : "day") + std::to_string(day));
+    Target target{day_dir / "gen", day_dir / ("part" + std::to_string(part))};
+    for (const auto& executable : {target.generator, target.part})
+    {
+        if (not std::filesystem::exists(executable))
+        {
+            throw std::invalid_argument{CONCAT("Executable ", executable.string(), " does not exist")};
+        }
+    }
+    return target;
+}
+
+std::vector<double> parse_scales(const utility::Arguments& args)
+{
+    const auto option = utility::get_option(args, "scales").value_or("1,2,4,8,16");
+    std::vector<double> scales;
+    for (std::string_view rest{option}; not rest.empty();)
+    {
+        const auto separator = std::min(rest.find(','), rest.size());
+        scales.push_back(std::stod(std::string{rest.substr(0, separator)}));
+        rest.remove_prefix(std::min(separator + 1, rest.size()));
+    }
+    if (scales.size() < 2)
+    {
+        throw std::invalid_argument{"At least two scales are needed to fit a curve"};
+    }
+    return scales;
+}
+
+unsigned long long parse_number_option(const utility::Arguments& args, std::string_view name, unsigned long long value)
+{
+    if (const auto option = utility::get_option(args, name); option.has_value())
+    {
+        return std::get<0>(utility::scan<"{u}">(*option));
+    }
+    return value;
+}
+
+struct Usage
+{
+    Clock::duration wall_time;
+    long peak_rss_kb;
+};
+
+// Runs the program with its standard output redirected to the given file and waits for it to exit successfully.
+Usage run_process(const std::vector<std::string>& command, int output_fd)
+{
+    std::vector<char*> argv;
+    for (const auto& argument : command)
+    {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    ::posix_spawn_file_actions_init(&actions);
+    ::posix_spawn_file_actions_adddup2(&actions, output_fd, STDOUT_FILENO);
+    const auto start = Clock::now();
+    pid_t pid;
+    const auto error = ::posix_spawn(&pid, argv.front(), &actions, nullptr, argv.data(), environ);
+    ::posix_spawn_file_actions_destroy(&actions);
+    if (error != 0)
+    {
+        throw std::logic_error{CONCAT("Process ", command.front(), " could not be started: ", std::strerror(error))};
+    }
+
+    int status;
+    rusage usage;
+    if (::wait4(pid, &status, 0, &usage) < 0)
+    {
+        throw std::logic_error{CONCAT("Process ", command.front(), " could not be awaited: ", std::strerror(errno))};
+    }
+    const auto wall_time = Clock::now() - start;
+    if (not WIFEXITED(status) or WEXITSTATUS(status) != 0)
+    {
+        throw std::logic_error{CONCAT("Process ", command.front(), " failed")};
+    }
+    return Usage{wall_time, usage.ru_maxrss};
+}
+
+class File
+{
+public:
+    explicit File(const std::filesystem::path& path, int flags) : fd{::open(path.c_str(), flags, 0600)}
+    {
+        if (fd < 0)
+        {
+            throw std::logic_error{CONCAT("File ", path.string(), " could not be open: ", std::strerror(errno))};
+        }
+    }
+
+    File(const File&) = delete;
+
+    File& operator=(const File&) = delete;
+
+    ~File()
+    {
+        ::close(fd);
+    }
+
+    int get() const { return fd; }
+
+private:
+    int fd;
+};
+
+// File with a unique name in the temporary directory, created for the user only and removed on destruction.
+class TemporaryFile
+{
+public:
+    TemporaryFile()
+    {
+        auto name = (std::filesystem::temp_directory_path() / "aoc-sweep-XXXXXX").string();
+        fd = ::mkostemp(name.data(), O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::logic_error{CONCAT("Temporary file could not be created: ", std::strerror(errno))};
+        }
+        path = name;
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    ~TemporaryFile()
+    {
+        ::close(fd);
+        ::unlink(path.c_str());
+    }
+
+    int get() const { return fd; }
+
+    const std::filesystem::path& get_path() const { return path; }
+
+private:
+    int fd;
+    std::filesystem::path path;
+};
+
+struct Sample
+{
+    double scale;
+    std::uintmax_t bytes;
+    Clock::duration wall_time;
+    long peak_rss_kb;
+};
+
+Sample measure(const Target& target, double scale, unsigned long long seed, unsigned long long repeats)
+{
+    const TemporaryFile input;
+    run_process({target.generator, std::to_string(scale), std::to_string(seed)}, input.get());
+    Sample sample{scale, std::filesystem::file_size(input.get_path()), Clock::duration::max(), 0};
+    const File null{"/dev/null", O_WRONLY};
+    for (auto repeat = 0ull; repeat < repeats; ++repeat)
+    {
+        const auto usage = run_process({target.part, input.get_path(), "--no-result-cache"}, null.get());
+        sample.wall_time = std::min(sample.wall_time, usage.wall_time);
+        sample.peak_rss_kb = std::max(sample.peak_rss_kb, usage.peak_rss_kb);
+    }
+    return sample;
+}
+
+// Exponent k of the power law y = c * x^k fitted by least squares on logarithms of both values.
+template <typename X, typename Y>
+double fit_exponent(const std::vector<Sample>& samples, X get_x, Y get_y)
+{
+    double sum_x{0.0}, sum_y{0.0}, sum_xx{0.0}, sum_xy{0.0};
+    for (const auto& sample : samples)
+    {
+        const auto x = std::log(static_cast<double>(get_x(sample)));
+        const auto y = std::log(std::max(static_cast<double>(get_y(sample)), 1e-9));
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    const auto count = static_cast<double>(samples.size());
+    const auto denominator = count * sum_xx - sum_x * sum_x;
+    return denominator == 0.0 ? 0.0 : (count * sum_xy - sum_x * sum_y) / denominator;
+}
+
+double to_milliseconds(Clock::duration time)
+{
+    return std::chrono::duration<double, std::milli>{time}.count();
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const auto args = utility::parse_arguments(argc, argv);
+        const auto target = find_target(args);
+        const auto scales = parse_scales(args);
+        const auto seed = parse_number_option(args, "seed", 2023);
+        const auto repeats = std::max(1ull, parse_number_option(args, "repeats", 3));
+
+        std::cout << std::setw(10) << "scale" << std::setw(14) << "bytes"
+            << std::setw(14) << "time ms" << std::setw(14) << "peak rss kB" << std::endl;
+        std::vector<Sample> samples;
+        for (const auto scale : scales)
+        {
+            const auto& sample = samples.emplace_back(measure(target, scale, seed, repeats));
+            std::cout << std::fixed << std::setprecision(2) << std::setw(10) << sample.scale
+                << std::setw(14) << sample.bytes
+                << std::setprecision(3) << std::setw(14) << to_milliseconds(sample.wall_time)
+                << std::setw(14) << sample.peak_rss_kb << std::endl;
+        }
+
+        const auto get_bytes = [](const Sample& sample) { return sample.bytes; };
+        const auto get_time = [](const Sample& sample) { return to_milliseconds(sample.wall_time); };
+        const auto get_memory = [](const Sample& sample) { return sample.peak_rss_kb; };
+        std::cout << std::setprecision(2)
+            << "time ~ n^" << fit_exponent(samples, get_bytes, get_time) << '\n'
+            << "peak rss ~ n^" << fit_exponent(samples, get_bytes, get_memory) << std::endl;
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+    return 0;
+}
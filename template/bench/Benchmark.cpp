@@ -0,0 +1,14 @@
+#include "../src/Task.cpp"
+#include "bench/Bench.hpp"
+
+namespace
+{
+using bench::solve;
+
+constexpr std::string_view example{R"()"};
+} // namespace
+
+BENCHMARK_CAPTURE(solve, part1, example, task::solve_part1)->Arg(1)->Arg(1000)->UseRealTime();
+BENCHMARK_CAPTURE(solve, part2, example, task::solve_part2)->Arg(1)->Arg(1000)->UseRealTime();
+
+BENCHMARK_MAIN();
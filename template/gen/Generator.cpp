@@ -0,0 +1,22 @@
+#include "gen/Generator.hpp"
+
+namespace
+{
+void generate(gen::Output& output, gen::Random& random, double scale)
+{
+    const auto line_count = gen::scaled(scale, 1000);
+    for (auto line = 0ull; line < line_count; ++line)
+    {
+        if (line > 0)
+        {
+            output.put('\n');
+        }
+        output.write_number(gen::uniform(random, 0, 100));
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    return gen::run(argc, argv, generate);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace utility
+{
+// Totals of the global operator new and delete since the start of the program, counted only while tracking is
+// enabled. Live and peak bytes are usable sizes of the blocks, so they include the allocator's rounding.
+struct AllocationCounters
+{
+    unsigned long long allocations, deallocations, allocated_bytes;
+    long long live_bytes;
+};
+
+// Tracking is compiled out with AOC_DISABLE_ALLOCATION_TRACKING, in which case it cannot be enabled.
+bool is_allocation_tracking_available();
+
+bool is_allocation_tracking_enabled();
+
+void set_allocation_tracking_enabled(bool);
+
+AllocationCounters get_allocation_counters();
+
+// Starts measuring the peak of live bytes from their current value and returns the peak measured so far, which
+// has to be passed to the matching `end_peak_measurement`. Measurements nest, but the peaks of measurements that
+// overlap on different threads are only approximate.
+long long begin_peak_measurement();
+
+// Returns the peak of live bytes since the matching `begin_peak_measurement`.
+long long end_peak_measurement(long long previous_peak);
+} // namespace utility
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+namespace utility
+{
+// Memory resource for a single solve. Everything allocated from it is released at once when it is destroyed.
+// In pooled mode freed blocks are recycled, which suits containers that are built and dropped repeatedly.
+class Arena
+{
+public:
+    enum class Mode
+    {
+        monotonic, pooled
+    };
+
+    Arena(Mode = Mode::monotonic, std::size_t initial_size = 64 * 1024);
+
+    Arena(const Arena&) = delete;
+
+    Arena& operator=(const Arena&) = delete;
+
+    std::pmr::memory_resource* get_resource();
+
+    void release();
+
+private:
+    std::pmr::monotonic_buffer_resource buffer;
+    std::optional<std::pmr::unsynchronized_pool_resource> pool;
+};
+
+// Makes the arena the current memory resource of the calling thread until the scope ends.
+class ArenaScope
+{
+public:
+    ArenaScope(Arena&);
+
+    ArenaScope(const ArenaScope&) = delete;
+
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    ~ArenaScope();
+
+private:
+    std::pmr::memory_resource* previous_resource;
+};
+
+// Resource of the innermost ArenaScope on this thread, std::pmr::get_default_resource() outside of any.
+std::pmr::memory_resource* get_current_resource();
+} // namespace utility
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "utility/Dbg.hpp"
+#include "utility/MappedFile.hpp"
 #include <fstream>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace utility
@@ -10,7 +13,17 @@ namespace utility
 using Arguments = std::vector<std::string>;
 Arguments parse_arguments(int, char**);
 
+// First argument which is not an option.
 std::string get_input_filename(const Arguments&);
 
+// Every argument which is not an option, with each directory replaced by the regular files in it in order of their
+// names.
+std::vector<std::string> get_input_filenames(const Arguments&);
+
+// Value of an option given as `--name=value`, or an empty string when given as `--name`.
+std::optional<std::string> get_option(const Arguments&, std::string_view name);
+
 std::ifstream open_file(const std::string&);
+
+MappedFile map_file(const std::string&);
 } // namespace utility
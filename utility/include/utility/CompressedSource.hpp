@@ -0,0 +1,74 @@
+#pragma once
+
+#include "utility/Source.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace utility
+{
+enum class Compression
+{
+    none, gzip, zstd
+};
+
+// Tells the compression of a file from its magic bytes.
+Compression detect_compression(const std::string& filename);
+
+// Decompresses another source on a background thread. Decompressed buffers are handed over through a bounded queue,
+// so decompression runs ahead of the reader by at most `buffer_count` buffers.
+class DecompressingSource : public Source
+{
+public:
+    DecompressingSource(
+        std::unique_ptr<Source> compressed,
+        Compression,
+        std::size_t buffer_count = 4,
+        std::size_t buffer_size = 1024 * 1024);
+
+    DecompressingSource(const DecompressingSource&) = delete;
+
+    DecompressingSource& operator=(const DecompressingSource&) = delete;
+
+    ~DecompressingSource() override;
+
+    std::string_view read() override;
+
+    class Decompressor
+    {
+    public:
+        virtual ~Decompressor() = default;
+
+        // Fills the buffer with decompressed data and returns the size written, which is 0 only at the end.
+        virtual std::size_t decompress(char* buffer, std::size_t size) = 0;
+    };
+
+private:
+    struct Buffer
+    {
+        std::vector<char> data;
+        std::size_t size;
+    };
+
+    void decompress_all(std::stop_token);
+
+    std::unique_ptr<Source> compressed;
+    std::unique_ptr<Decompressor> decompressor;
+    std::vector<Buffer> buffers;
+    std::mutex mutex;
+    std::condition_variable_any condition;
+    std::deque<Buffer*> free_buffers, filled_buffers;
+    bool is_finished;
+    std::exception_ptr exception;
+    Buffer* current;
+    std::jthread worker;
+};
+} // namespace utility
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string_view>
+
+namespace utility
+{
+// Instruction set levels with their own kernel variants, from the most basic one.
+enum class Isa
+{
+    scalar, sse2, avx2
+};
+
+std::string_view get_isa_name(Isa);
+
+// Best level supported by the processor and the operating system, detected once with cpuid.
+Isa get_supported_isa();
+
+// Level kernels should use: the supported one, lowered to the one named by the AOC_ISA environment variable
+// (scalar, sse2 or avx2) when it is set, so that every variant can be run on the same machine.
+Isa get_selected_isa();
+
+// Picks the variant of a kernel for the selected level. Meant to be called once and kept in a static.
+template <typename Function>
+Function* select_kernel(Function* scalar, Function* sse2, Function* avx2)
+{
+    switch (get_selected_isa())
+    {
+        case Isa::avx2: return avx2;
+        case Isa::sse2: return sse2;
+        case Isa::scalar: return scalar;
+    }
+    return scalar;
+}
+} // namespace utility
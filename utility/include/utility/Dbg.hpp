@@ -1,5 +1,6 @@
 #pragma once
 
+#include "utility/Log.hpp"
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
@@ -8,13 +9,12 @@
 #include <sstream>
 #include <stack>
 #include <string>
+#include <string_view>
 
-std::string get_filename(std::string);
+std::string_view get_filename(std::string_view);
 
 #define LOCATION std::string{"["}.append(get_filename(__FILE__)).append(":").append(std::to_string(__LINE__)).append("]")
 
-#define LOG_MACRO(arg) std::cout << LOCATION << ' ' << arg << std::endl;
-
 template <typename T>
 void print(std::ostream& stream, const T& data)
 {
@@ -65,20 +65,27 @@ void print(std::ostream& stream, const String& string)
     stream << std::quoted(string);
 }
 
+// Containers longer than this are printed truncated, followed by the count of the elements left out.
+constexpr std::size_t max_printed_elements{32};
+
 template <Iterable Container> requires (not Stringable<Container>)
 void print(std::ostream& stream, const Container& container)
 {
     stream << '[';
-    if (not container.empty())
+    std::size_t count{0};
+    for (const auto& element : container)
     {
-        const auto first_element_iter = container.begin();
-        const auto size = container.size();
-        const auto last_element_iter = std::next(first_element_iter, size - 1);
-        std::for_each(first_element_iter, last_element_iter, [&stream](const auto& e) {
-            print(stream, e);
+        if (count == max_printed_elements)
+        {
+            stream << ", ... " << std::size(container) - count << " more";
+            break;
+        }
+        if (count > 0)
+        {
             stream << ", ";
-        });
-        print(stream, *last_element_iter);
+        }
+        print(stream, element);
+        ++count;
     }
     stream << ']';
 }
@@ -93,18 +100,6 @@ void print(std::ostream& stream, const std::optional<T>& opt)
     stream << "nullopt";
 }
 
-#define DBG(expr) \
-    [&](auto&& e) -> decltype(auto) { \
-        using Expr = decltype(e); \
-        std::stringstream stream; \
-        stream << std::boolalpha; \
-        stream << #expr << ':'; \
-        print(stream, e); \
-        stream << std::noboolalpha; \
-        LOG_MACRO(stream.str()); \
-        return std::forward<Expr>(e); \
-    } (expr)
-
 struct Stringified
 {
     std::string string;
@@ -122,16 +117,6 @@ std::ostream& operator<<(std::ostream&, const Stringified&);
         return Stringified{stream.str()}; \
     } (expr)
 
-template <typename ... Ts>
-void log(const std::string& location, const Ts& ... data)
-{
-    std::cout << location << ' ';
-    ((print(std::cout, data)), ...);
-    std::cout << std::endl;
-}
-
-#define LOG(...) log(LOCATION, __VA_ARGS__)
-
 template <typename ... Ts>
 std::string concatenate(const Ts& ... data)
 {
@@ -142,30 +127,64 @@ std::string concatenate(const Ts& ... data)
 
 #define CONCAT(...) concatenate(__VA_ARGS__)
 
-template <typename T>
-void log_params_rest(const T& data)
-{
-    print(std::cout, data);
-    std::cout << std::endl;
-}
+// Stream of the calling thread, reused by its messages, cleared and started with the location of the message.
+std::ostream& start_log_message(utility::LogLevel, std::string_view file, int line);
 
-template <typename T, typename ... Ts>
-void log_params_rest(const T& data, const Ts& ... tail)
-{
-    print(std::cout, data);
-    std::cout << ", ";
-    log_params_rest(tail...);
-}
+// Queues the message written to the stream for the logger thread.
+void finish_log_message(utility::LogLevel);
 
 template <typename ... Ts>
-void log_params(const std::string& location, const Ts& ... data)
+void log_message(utility::LogLevel level, std::string_view file, int line, const Ts& ... data)
 {
-    std::cout << location << ' ';
-    log_params_rest(data...);
+    auto& stream = start_log_message(level, file, line);
+    ((print(stream, data)), ...);
+    finish_log_message(level);
 }
 
-#define LOG_PARAM(...) log_params(LOCATION, __VA_ARGS__)
+template <typename T, typename ... Ts>
+void log_params(utility::LogLevel level, std::string_view file, int line, const T& data, const Ts& ... tail)
+{
+    auto& stream = start_log_message(level, file, line);
+    print(stream, data);
+    ((stream << ", ", print(stream, tail)), ...);
+    finish_log_message(level);
+}
 
-#define LOG_SEPARATOR() log(LOCATION, "----------------------------------------------------------------------")
+#if AOC_LOG_LEVEL <= AOC_LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) log_message(utility::LogLevel::debug, __FILE__, __LINE__, __VA_ARGS__)
+#define LOG_PARAM(...) log_params(utility::LogLevel::debug, __FILE__, __LINE__, __VA_ARGS__)
+#define DBG(expr) \
+    [&](auto&& e) -> decltype(auto) { \
+        using Expr = decltype(e); \
+        LOG_DEBUG(#expr ":", e); \
+        return std::forward<Expr>(e); \
+    } (expr)
+#else
+#define LOG_DEBUG(...) static_cast<void>(0)
+#define LOG_PARAM(...) static_cast<void>(0)
+#define DBG(expr) (expr)
+#endif
+
+#if AOC_LOG_LEVEL <= AOC_LOG_LEVEL_INFO
+#define LOG_INFO(...) log_message(utility::LogLevel::info, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define LOG_INFO(...) static_cast<void>(0)
+#endif
+
+#if AOC_LOG_LEVEL <= AOC_LOG_LEVEL_WARNING
+#define LOG_WARNING(...) log_message(utility::LogLevel::warning, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) static_cast<void>(0)
+#endif
+
+#if AOC_LOG_LEVEL <= AOC_LOG_LEVEL_ERROR
+#define LOG_ERROR(...) log_message(utility::LogLevel::error, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) static_cast<void>(0)
+#endif
+
+#define LOG(...) LOG_INFO(__VA_ARGS__)
+
+#define LOG_SEPARATOR() LOG_DEBUG("----------------------------------------------------------------------")
 
 #define WAIT() std::cin.get();
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "utility/Source.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utility
+{
+// Reads a file with blocking pread calls into a single buffer.
+class PreadSource : public Source
+{
+public:
+    PreadSource(const std::string& filename, std::size_t buffer_size = 1024 * 1024);
+
+    PreadSource(const PreadSource&) = delete;
+
+    PreadSource& operator=(const PreadSource&) = delete;
+
+    ~PreadSource() override;
+
+    std::string_view read() override;
+
+private:
+    int fd;
+    std::size_t offset;
+    std::vector<char> buffer;
+};
+
+// Reads a file through io_uring, keeping reads of the following buffers in flight while the current one is
+// processed. Buffers are handed out in file order and each of them is reused for a new read once the next one is
+// requested.
+class UringSource : public Source
+{
+public:
+    UringSource(const std::string& filename, unsigned buffer_count = 4, std::size_t buffer_size = 1024 * 1024);
+
+    UringSource(const UringSource&) = delete;
+
+    UringSource& operator=(const UringSource&) = delete;
+
+    ~UringSource() override;
+
+    std::string_view read() override;
+
+    // Whether the kernel lets this process set up an io_uring, checked once.
+    static bool is_available();
+
+private:
+    struct Ring;
+    struct Slot
+    {
+        std::vector<char> buffer;
+        std::size_t offset, length, filled;
+        bool is_complete;
+    };
+
+    void submit(std::size_t slot_index);
+
+    void wait_for(std::size_t slot_index);
+
+    std::string filename;
+    int fd;
+    std::size_t file_size, next_offset;
+    std::unique_ptr<Ring> ring;
+    std::vector<Slot> slots;
+    std::size_t current_slot;
+    bool is_slot_handed_out;
+};
+
+// Ways of reading an input file: mapping it into memory whole, or reading it in buffers through a Source.
+enum class Reader
+{
+    mmap, uring, pread
+};
+
+Reader parse_reader(std::string_view);
+
+// Source reading the file in buffers. The io_uring reader falls back to blocking reads where io_uring is not
+// available. Files compressed with gzip or zstd are decompressed on the fly.
+std::unique_ptr<Source> open_file_source(const std::string& filename, Reader = Reader::uring);
+} // namespace utility
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace utility
+{
+class Stream;
+
+// Row-major 2D container stored in a single buffer. The cells can be surrounded by a ring of `padding` sentinel
+// cells, so that neighbours of any inner cell are reachable through flat offsets without bounds checks.
+template <typename T>
+class Grid
+{
+public:
+    using Index = std::ptrdiff_t;
+
+    Grid() : Grid{0, 0, T{}}
+    {
+    }
+
+    Grid(int width, int height, const T& value, int padding = 0)
+        : width{width}
+        , height{height}
+        , padding{padding}
+        , stride{width + 2 * padding}
+        , cells(static_cast<std::size_t>(stride * (height + 2 * padding)), value)
+    {
+    }
+
+    Grid(int width, int height, int padding, std::vector<T> cells)
+        : width{width}, height{height}, padding{padding}, stride{width + 2 * padding}, cells(std::move(cells))
+    {
+        if (this->cells.size() != static_cast<std::size_t>(stride * (height + 2 * padding)))
+        {
+            throw std::invalid_argument{"Grid cells do not match its size"};
+        }
+    }
+
+    int get_width() const { return width; }
+
+    int get_height() const { return height; }
+
+    int get_padding() const { return padding; }
+
+    bool is_within_bounds(int x, int y) const
+    {
+        return x >= 0 and x < width and y >= 0 and y < height;
+    }
+
+    Index to_index(int x, int y) const
+    {
+        return static_cast<Index>(y + padding) * stride + (x + padding);
+    }
+
+    int get_x(Index index) const { return static_cast<int>(index % stride) - padding; }
+
+    int get_y(Index index) const { return static_cast<int>(index / stride) - padding; }
+
+    Index get_offset(int dx, int dy) const
+    {
+        return static_cast<Index>(dy) * stride + dx;
+    }
+
+    // Offsets of the 8 surrounding cells, valid for every inner cell when padding is at least 1.
+    std::array<Index, 8> get_neighbour_offsets() const
+    {
+        return {
+            get_offset(-1, -1), get_offset(0, -1), get_offset(1, -1),
+            get_offset(-1, 0), get_offset(1, 0),
+            get_offset(-1, 1), get_offset(0, 1), get_offset(1, 1),
+        };
+    }
+
+    T& operator[](Index index) { return cells[static_cast<std::size_t>(index)]; }
+
+    const T& operator[](Index index) const { return cells[static_cast<std::size_t>(index)]; }
+
+    T& at(int x, int y) { return (*this)[to_index(x, y)]; }
+
+    const T& at(int x, int y) const { return (*this)[to_index(x, y)]; }
+
+    std::span<T> get_row(int y)
+    {
+        return std::span<T>{cells}.subspan(static_cast<std::size_t>(to_index(0, y)), static_cast<std::size_t>(width));
+    }
+
+    std::span<const T> get_row(int y) const
+    {
+        return std::span<const T>{cells}.subspan(
+            static_cast<std::size_t>(to_index(0, y)), static_cast<std::size_t>(width));
+    }
+
+    std::span<T> get_cells() { return cells; }
+
+    std::span<const T> get_cells() const { return cells; }
+
+private:
+    int width, height, padding, stride;
+    std::vector<T> cells;
+};
+
+// Reads the remaining non-empty lines of the stream as rows of a character grid surrounded by `padding` cells
+// filled with `border`.
+Grid<char> parse_grid(Stream&, char border = '\0', int padding = 0);
+} // namespace utility
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace utility
+{
+// Fast non-cryptographic hash of a text fed in consecutive pieces, so that it can be computed while the text is
+// read. Four independent lanes of 8 bytes are mixed per step, so it runs at about the bandwidth of memory, and the
+// result does not depend on how the text is split into pieces.
+class TextHasher
+{
+public:
+    void update(std::string_view);
+
+    std::uint64_t finish() const;
+
+    std::uint64_t get_size() const { return size; }
+
+private:
+    static constexpr std::size_t block_size{32};
+
+    void mix_block(const char*);
+
+    std::array<std::uint64_t, 4> lanes{
+        0x9e3779b97f4a7c15ull, 0x3c6ef372fe94f82aull, 0xdaa66d2c7ddf743full, 0x61c8864680b583ebull};
+    std::array<char, block_size> pending{};
+    std::size_t pending_size{0};
+    std::uint64_t size{0};
+};
+
+// Hash of a whole text, the same as the one of TextHasher fed with it.
+std::uint64_t hash_text(std::string_view);
+} // namespace utility
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string_view>
+
+#define AOC_LOG_LEVEL_DEBUG 0
+#define AOC_LOG_LEVEL_INFO 1
+#define AOC_LOG_LEVEL_WARNING 2
+#define AOC_LOG_LEVEL_ERROR 3
+#define AOC_LOG_LEVEL_OFF 4
+
+// Messages below this level are compiled out, including the evaluation of their arguments.
+#ifndef AOC_LOG_LEVEL
+#define AOC_LOG_LEVEL AOC_LOG_LEVEL_DEBUG
+#endif
+
+namespace utility
+{
+enum class LogLevel
+{
+    debug, info, warning, error
+};
+
+// Queues a debug or info message for the background thread which writes it to stdout, so that logging does not wait
+// for the output. When the queue is full such messages are dropped instead of blocking the caller, and the number of
+// dropped messages is written in their place. Warnings, errors and messages longer than a slot of the queue are
+// written before returning, after the messages queued before them.
+void write_log(LogLevel, std::string_view message);
+
+// Waits until every queued message is written. Also done at exit.
+void flush_log();
+} // namespace utility
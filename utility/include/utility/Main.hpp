@@ -0,0 +1,319 @@
+#pragma once
+
+#include "utility/Allocation.hpp"
+#include "utility/Arguments.hpp"
+#include "utility/CompressedSource.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/FileSource.hpp"
+#include "utility/Log.hpp"
+#include "utility/ParseCache.hpp"
+#include "utility/PerfCounters.hpp"
+#include "utility/ResultCache.hpp"
+#include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include "utility/Trace.hpp"
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace utility
+{
+// Answers as printed, either a single one or one for each part.
+using AnswerTexts = std::vector<std::string>;
+
+template <typename Answer>
+AnswerTexts format_answers(const Answer& answer)
+{
+    std::ostringstream text;
+    text << answer;
+    return {text.str()};
+}
+
+template <typename Answer>
+AnswerTexts format_answers(const std::pair<Answer, Answer>& answers)
+{
+    return {format_answers(answers.first).front(), format_answers(answers.second).front()};
+}
+
+// Answers are cached on a single line, separated by spaces.
+inline std::string join_answers(const AnswerTexts& answers)
+{
+    std::string text;
+    for (const auto& answer : answers)
+    {
+        text += text.empty() ? answer : " " + answer;
+    }
+    return text;
+}
+
+inline AnswerTexts split_answers(std::string_view text)
+{
+    AnswerTexts answers;
+    while (true)
+    {
+        const auto space = text.find(' ');
+        answers.emplace_back(text.substr(0, space));
+        if (space == std::string_view::npos)
+        {
+            return answers;
+        }
+        text.remove_prefix(space + 1);
+    }
+}
+
+// Whether the input file is mapped into memory whole, rather than read in buffers through a Source.
+inline bool is_mapped(const std::string& input_filename, Reader reader)
+{
+    return reader == Reader::mmap and detect_compression(input_filename) == Compression::none;
+}
+
+// Source reading the input file in buffers, through io_uring unless another reader is selected.
+inline std::unique_ptr<Source> open_buffered_source(const std::string& input_filename, Reader reader)
+{
+    return open_file_source(input_filename, reader == Reader::mmap ? Reader::uring : reader);
+}
+
+// Solves the input file read as selected and returns the answers as printed.
+template <typename Answer>
+AnswerTexts solve_file(const std::string& input_filename, Reader reader, Answer (*solve)(Stream&))
+{
+    const auto answer = [&] {
+        TIME_SCOPE("total");
+        if (not is_mapped(input_filename, reader))
+        {
+            auto stream = [&] {
+                TIME_SCOPE("open");
+                return Stream{open_buffered_source(input_filename, reader)};
+            }();
+            TIME_SCOPE("solve");
+            return solve(stream);
+        }
+        const auto input_file = [&] {
+            TIME_SCOPE("open");
+            return map_file(input_filename);
+        }();
+        Stream stream{input_file.get_contents()};
+        TIME_SCOPE("solve");
+        return solve(stream);
+    }();
+    return format_answers(answer);
+}
+
+// Answers of the input file, taken from the result cache when it holds them and stored there otherwise. The input is
+// read only once: a mapped input is hashed to look up its answers and then solved in place, while an input read in
+// buffers is hashed as it is solved. The key of the latter is stored for the file afterwards, so that the next run
+// finds its answers without reading it, as long as the file has not changed.
+template <typename Answer>
+AnswerTexts solve_file_cached(
+    std::string_view solver_name, const std::string& input_filename, Reader reader, Answer (*solve)(Stream&))
+{
+    if (not is_result_cache_enabled())
+    {
+        return solve_file(input_filename, reader, solve);
+    }
+    TextHasher hasher;
+    if (is_mapped(input_filename, reader))
+    {
+        const auto input_file = map_file(input_filename);
+        hasher.update(input_file.get_contents());
+        const auto key = make_result_cache_key(solver_name, hasher);
+        if (const auto cached_answers = find_cached_result(key); cached_answers.has_value())
+        {
+            return split_answers(*cached_answers);
+        }
+        Stream stream{input_file.get_contents()};
+        auto answers = format_answers(solve(stream));
+        store_cached_result(key, join_answers(answers));
+        return answers;
+    }
+
+    const auto stamp = read_file_stamp(input_filename);
+    if (const auto key = stamp.has_value() ? find_cached_key(solver_name, *stamp) : std::nullopt; key.has_value())
+    {
+        if (const auto cached_answers = find_cached_result(*key); cached_answers.has_value())
+        {
+            return split_answers(*cached_answers);
+        }
+    }
+    HashingSource source{open_buffered_source(input_filename, reader), hasher};
+    Stream stream{source};
+    auto answers = format_answers(solve(stream));
+    source.drain();
+    const auto key = make_result_cache_key(solver_name, hasher);
+    store_cached_result(key, join_answers(answers));
+    // A file written while it was read may already hold another input.
+    if (stamp.has_value() and read_file_stamp(input_filename) == stamp)
+    {
+        store_cached_key(key, *stamp);
+    }
+    return answers;
+}
+
+inline void print_answers(std::string_view prefix, const AnswerTexts& answers)
+{
+    for (auto index = 0u; index < answers.size(); ++index)
+    {
+        std::cout << prefix;
+        if (answers.size() > 1)
+        {
+            std::cout << " part" << index + 1;
+        }
+        std::cout << " answer:" << answers[index] << std::endl;
+    }
+}
+
+// Solves the input files concurrently, each on its own task of the default ThreadPool, and prints the answers of
+// each file after its name, in the order of the files. A file which fails gets an error line instead, and the others
+// are still solved. Returns whether every file was solved.
+template <typename Answer>
+bool solve_files(
+    std::string_view solver_name,
+    const std::vector<std::string>& input_filenames,
+    Reader reader,
+    Answer (*solve)(Stream&))
+{
+    std::vector<AnswerTexts> answers(input_filenames.size());
+    std::vector<std::optional<std::string>> errors(input_filenames.size());
+    const auto solve_one_file = [&](std::size_t index) {
+        try
+        {
+            answers[index] = solve_file_cached(solver_name, input_filenames[index], reader, solve);
+        }
+        catch (const std::exception& e)
+        {
+            errors[index] = e.what();
+        }
+    };
+    constexpr auto file_per_task = 1u;
+    parallel_for(0, input_filenames.size(), solve_one_file, file_per_task);
+    flush_log();
+    for (auto index = 0u; index < input_filenames.size(); ++index)
+    {
+        if (errors[index].has_value())
+        {
+            std::cout << input_filenames[index] << " error:" << *errors[index] << std::endl;
+            continue;
+        }
+        print_answers(input_filenames[index], answers[index]);
+    }
+    return std::ranges::none_of(errors, [](const auto& error) { return error.has_value(); });
+}
+
+// Body of every part executable: solves the input file given as the first argument and prints the answer. The
+// combined executables of the days print the answers of both parts, each on its own line. Given several files or a
+// directory of them, the executable solves all of them in one process, as described at `solve_files`.
+// With `--timings[=text|json]` the time spent in each phase of the run is reported to stderr afterwards, and with
+// `--allocations` also the allocations made in each phase. With `--counters` the phases also report hardware
+// counters, when the system permits reading them. With `--trace=<file>` the spans of the phases on each thread are
+// written to the file as Chrome Trace Event JSON. The file is mapped into memory unless `--reader=uring` or
+// `--reader=pread` selects reading it in buffers, which lets parsing overlap reading with io_uring. Files compressed
+// with gzip or zstd are always read in buffers and decompressed on a separate thread. With `--parse-cache[=<dir>]` the
+// days which support it store their parsed input in the directory and load it from there on later runs.
+// Answers are cached by the hash of the input, the solver and the build of the executable, in the directory given by
+// `--result-cache=<dir>` and limited to `--result-cache-size=<bytes>`. The cache is bypassed with `--no-result-cache`
+// and whenever the run is measured.
+template <typename Answer>
+int run(int argc, char* argv[], Answer (*solve)(Stream&))
+{
+#ifdef AOC_SOLVER_NAME
+    constexpr std::string_view solver_name{AOC_SOLVER_NAME};
+#else
+    constexpr std::string_view solver_name{};
+#endif
+    try
+    {
+        const auto args = parse_arguments(argc, argv);
+        const auto timings_option = get_option(args, "timings");
+        std::optional<TimingFormat> timing_format;
+        if (timings_option.has_value())
+        {
+            timing_format = parse_timing_format(*timings_option);
+            ScopedTimer::set_enabled(true);
+        }
+        if (get_option(args, "allocations").has_value())
+        {
+            if (not is_allocation_tracking_available())
+            {
+                throw std::invalid_argument{"Allocation tracking is compiled out"};
+            }
+            set_allocation_tracking_enabled(true);
+            ScopedTimer::set_enabled(true);
+            timing_format = timing_format.value_or(TimingFormat::text);
+        }
+        if (get_option(args, "counters").has_value())
+        {
+            if (not enable_perf_counters())
+            {
+                std::cerr << "Hardware counters are unavailable: " << get_perf_counters_error() << std::endl;
+            }
+            ScopedTimer::set_enabled(true);
+            timing_format = timing_format.value_or(TimingFormat::text);
+        }
+
+        const auto trace_filename = get_option(args, "trace");
+        if (trace_filename.has_value())
+        {
+            if (trace_filename->empty())
+            {
+                throw std::invalid_argument{"No trace file provided"};
+            }
+            set_tracing_enabled(true);
+        }
+
+        if (const auto directory = get_option(args, "parse-cache"); directory.has_value())
+        {
+            enable_parse_cache(
+                directory->empty() ? get_default_parse_cache_directory() : std::filesystem::path{*directory});
+        }
+
+        const auto is_measured = timing_format.has_value() or trace_filename.has_value();
+        if (not solver_name.empty() and not is_measured and not get_option(args, "no-result-cache").has_value())
+        {
+            const auto directory = get_option(args, "result-cache").value_or("");
+            const auto size_limit = get_option(args, "result-cache-size");
+            enable_result_cache(
+                directory.empty() ? get_default_result_cache_directory() : std::filesystem::path{directory},
+                size_limit.has_value() ? std::stoull(*size_limit) : default_result_cache_size_limit);
+        }
+
+        const auto reader = parse_reader(get_option(args, "reader").value_or("mmap"));
+        const auto input_filenames = get_input_filenames(args);
+        auto is_solved = true;
+        if (input_filenames.size() > 1 or std::filesystem::is_directory(get_input_filename(args)))
+        {
+            is_solved = solve_files(solver_name, input_filenames, reader, solve);
+        }
+        else
+        {
+            const auto answers = solve_file_cached(solver_name, input_filenames.front(), reader, solve);
+            flush_log();
+            print_answers(LOCATION, answers);
+        }
+
+        if (timing_format.has_value())
+        {
+            print_timings(std::cerr, *timing_format);
+        }
+        if (trace_filename.has_value())
+        {
+            write_trace(*trace_filename);
+        }
+        return is_solved ? 0 : 1;
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+}
+} // namespace utility
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace utility
+{
+class MappedFile
+{
+public:
+    MappedFile(const std::string&);
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&&) noexcept;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile& operator=(MappedFile&&) noexcept;
+
+    ~MappedFile();
+
+    std::string_view get_contents() const;
+
+private:
+    const char* data;
+    std::size_t size;
+};
+} // namespace utility
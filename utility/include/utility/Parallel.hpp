@@ -0,0 +1,105 @@
+#pragma once
+
+#include "utility/Arena.hpp"
+#include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace utility
+{
+using Chunks = std::vector<std::string_view>;
+
+// Splits a buffer into at most `count` chunks which start and end on line boundaries.
+Chunks split_into_line_chunks(std::string_view, unsigned count);
+
+unsigned get_worker_count(std::string_view);
+
+// Merge of pairs of partial results, which adds up their first and their second elements separately.
+struct PairPlus
+{
+    template <typename First, typename Second>
+    std::pair<First, Second> operator()(std::pair<First, Second> lhs, const std::pair<First, Second>& rhs) const
+    {
+        lhs.first += rhs.first;
+        lhs.second += rhs.second;
+        return lhs;
+    }
+};
+
+// Calls both functions at the same time, the first one on the default ThreadPool and the second one on the calling
+// thread, and returns both results. Each call runs inside its own pooled Arena, so results must not allocate from it.
+template <typename First, typename Second>
+auto run_concurrently(First&& first, Second&& second)
+{
+    std::optional<std::invoke_result_t<First&>> first_result;
+    TaskGroup group;
+    group.run([&first, &first_result]() {
+        Arena arena{Arena::Mode::pooled};
+        const ArenaScope arena_scope{arena};
+        first_result.emplace(first());
+    });
+    auto second_result = [&second]() {
+        Arena arena{Arena::Mode::pooled};
+        const ArenaScope arena_scope{arena};
+        return second();
+    }();
+    group.wait();
+    return std::pair{std::move(*first_result), std::move(second_result)};
+}
+
+// Folds every non-empty line of the stream into a single value. Lines are processed in newline-aligned chunks on the
+// threads of the default ThreadPool, so `function` must be safe to call concurrently and `merge` must be associative.
+// Each worker runs inside its own pooled Arena, which is gone once the chunk is reduced, so partial results must not
+// allocate from it.
+template <typename T, typename LineFunction, typename Merge = std::plus<>>
+T parallel_line_reduce(Stream& stream, T init, LineFunction&& function, Merge&& merge = {})
+{
+    TIME_SCOPE("parallel_line_reduce");
+    const auto reduce_lines = [&function, &merge](Stream& lines) {
+        std::optional<T> partial;
+        for (const auto& line : lines)
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            partial = partial.has_value() ? merge(std::move(*partial), function(line)) : T(function(line));
+        }
+        return partial;
+    };
+
+    const auto buffer = stream.take_buffer();
+    if (not buffer.has_value())
+    {
+        const auto partial = reduce_lines(stream);
+        return partial.has_value() ? merge(std::move(init), *partial) : init;
+    }
+
+    const auto chunks = split_into_line_chunks(*buffer, get_worker_count(*buffer));
+    const auto reduce_chunk = [&reduce_lines, &chunks](std::size_t index) {
+        TIME_SCOPE("reduce_chunk");
+        Arena arena{Arena::Mode::pooled};
+        const ArenaScope arena_scope{arena};
+        Stream lines{chunks[index]};
+        return reduce_lines(lines);
+    };
+    const auto merge_partials = [&merge](std::optional<T> lhs, std::optional<T> rhs) {
+        TIME_SCOPE("merge_partial");
+        if (not lhs.has_value() or not rhs.has_value())
+        {
+            return lhs.has_value() ? std::move(lhs) : std::move(rhs);
+        }
+        return std::optional<T>{merge(std::move(*lhs), std::move(*rhs))};
+    };
+    constexpr auto chunk_per_task = 1u;
+    auto partial = parallel_reduce(
+        0, chunks.size(), std::optional<T>{}, reduce_chunk, merge_partials, chunk_per_task);
+    return partial.has_value() ? merge(std::move(init), std::move(*partial)) : init;
+}
+} // namespace utility
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "utility/Hash.hpp"
+#include "utility/MappedFile.hpp"
+#include "utility/Stream.hpp"
+#include "utility/Timer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace utility
+{
+// Identifies what a cache file holds. The version is raised whenever the layout written by the day changes.
+struct ParseCacheKey
+{
+    std::string_view name;
+    std::uint32_t version;
+};
+
+// Enables caching of parsed inputs in the directory, which is created when missing with access for the user only, or
+// leaves it disabled when the directory cannot be created or others can write to it.
+void enable_parse_cache(const std::filesystem::path& directory);
+
+bool is_parse_cache_enabled();
+
+// `aoc-parse-cache` in $XDG_CACHE_HOME, or in ~/.cache when it is not set.
+std::filesystem::path get_default_parse_cache_directory();
+
+template <typename T>
+concept Flat = std::is_trivially_copyable_v<T>;
+
+// Builds the payload of a cache file. Arrays are aligned for their type, so they can be read in place from a
+// mapping of the file.
+class ParseCacheWriter
+{
+public:
+    template <Flat T>
+    void write(const T& value)
+    {
+        write_bytes(&value, sizeof(T), alignof(T));
+    }
+
+    template <Flat T>
+    void write_array(std::span<const T> values)
+    {
+        write(static_cast<std::uint64_t>(values.size()));
+        write_bytes(values.data(), values.size_bytes(), alignof(T));
+    }
+
+    void write_string(std::string_view);
+
+    // Writes the lengths of all strings followed by their characters, in one block each.
+    template <typename Strings>
+    void write_strings(const Strings& strings)
+    {
+        std::vector<std::uint32_t> lengths;
+        std::string characters;
+        for (const std::string_view string : strings)
+        {
+            lengths.push_back(static_cast<std::uint32_t>(string.size()));
+            characters.append(string);
+        }
+        write_array<std::uint32_t>(lengths);
+        write_string(characters);
+    }
+
+    std::string_view get_payload() const;
+
+private:
+    std::string payload;
+
+    void write_bytes(const void* data, std::size_t size, std::size_t alignment);
+};
+
+// Reads a payload in the order it was written. Arrays and strings point into the payload without copying.
+class ParseCacheReader
+{
+public:
+    ParseCacheReader(std::string_view payload);
+
+    template <Flat T>
+    T read()
+    {
+        T value;
+        std::memcpy(&value, read_bytes(sizeof(T), alignof(T)), sizeof(T));
+        return value;
+    }
+
+    template <Flat T>
+    std::span<const T> read_array()
+    {
+        const auto size = read<std::uint64_t>();
+        const auto* data = read_bytes(size * sizeof(T), alignof(T));
+        return std::span<const T>{reinterpret_cast<const T*>(data), size};
+    }
+
+    std::string_view read_string();
+
+    std::vector<std::string_view> read_strings();
+
+private:
+    std::string_view payload;
+    std::size_t offset;
+
+    const char* read_bytes(std::size_t size, std::size_t alignment);
+};
+
+// Mapping of a valid cache file.
+class ParseCacheFile
+{
+public:
+    ParseCacheFile(MappedFile, std::string_view payload);
+
+    ParseCacheReader get_reader() const;
+
+private:
+    MappedFile file;
+    std::string_view payload;
+};
+
+// Opens the cache file of the text, when one was written with the same key and its header matches the text.
+std::optional<ParseCacheFile> open_parse_cache(const ParseCacheKey&, std::string_view text, std::uint64_t text_hash);
+
+// Writes the cache file of the text. Failures are only logged, as the cache is an optimisation.
+void store_parse_cache(
+    const ParseCacheKey&,
+    std::string_view text,
+    std::uint64_t text_hash,
+    const ParseCacheWriter&);
+
+// Parses the unread input with `parse`, unless a cache file of the same text exists, in which case the result is
+// rebuilt from it by `load` and the text is not parsed at all. After parsing, `save` writes the result for later
+// runs. Only input which is already in memory is cached, so it has to be parsed until its end.
+template <typename Parse, typename Save, typename Load>
+auto parse_cached(Stream& stream, const ParseCacheKey& key, Parse&& parse, Save&& save, Load&& load)
+{
+    if (not is_parse_cache_enabled())
+    {
+        return parse(stream);
+    }
+    const auto text = stream.take_buffer();
+    if (not text.has_value())
+    {
+        return parse(stream);
+    }
+    const auto text_hash = hash_text(*text);
+    {
+        TIME_SCOPE("load_parse_cache");
+        if (const auto cache = open_parse_cache(key, *text, text_hash); cache.has_value())
+        {
+            auto reader = cache->get_reader();
+            return load(reader);
+        }
+    }
+    Stream text_stream{*text};
+    auto result = parse(text_stream);
+    TIME_SCOPE("store_parse_cache");
+    ParseCacheWriter writer;
+    save(writer, result);
+    store_parse_cache(key, *text, text_hash, writer);
+    return result;
+}
+} // namespace utility
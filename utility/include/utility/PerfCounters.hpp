@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace utility
+{
+enum class PerfCounter
+{
+    cycles, instructions, l1d_misses, llc_misses, branch_misses
+};
+constexpr std::size_t perf_counter_count{5};
+
+using PerfCounterValues = std::array<unsigned long long, perf_counter_count>;
+
+std::string_view get_perf_counter_name(PerfCounter);
+
+// Enables the hardware counters, which are opened through perf_event_open for each thread on its first read,
+// counting user space only. Counters which the kernel or the hardware does not permit on the calling thread are left
+// out. Returns false when none could be opened, in which case `get_perf_counters_error` tells why and the counters
+// stay disabled.
+bool enable_perf_counters();
+
+bool are_perf_counters_enabled();
+
+bool is_perf_counter_available(PerfCounter);
+
+const std::string& get_perf_counters_error();
+
+// Current values of the counters of the calling thread, zero for the unavailable ones, scaled up when the kernel
+// could only count them for part of the time. Increments therefore have to be read on the same thread.
+PerfCounterValues read_perf_counters();
+} // namespace utility
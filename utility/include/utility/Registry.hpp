@@ -0,0 +1,61 @@
+#pragma once
+
+#include <compare>
+#include <functional>
+#include <map>
+#include <string_view>
+
+namespace utility
+{
+class Stream;
+
+using SolverAnswer = unsigned long long;
+using Solver = std::function<SolverAnswer (Stream&)>;
+
+struct SolverId
+{
+    unsigned day, part;
+
+    auto operator<=>(const SolverId&) const = default;
+};
+
+using Solvers = std::map<SolverId, Solver>;
+
+// Solvers of every day linked into the executable, ordered by day and part.
+const Solvers& get_solvers();
+
+void register_solver(SolverId, Solver);
+
+// Registers a solver during static initialization, when defined at namespace scope.
+class SolverRegistration
+{
+public:
+    template <typename Answer>
+    SolverRegistration(unsigned day, unsigned part, Answer (*solve)(Stream&))
+    {
+        register_solver(SolverId{day, part}, [solve](Stream& stream) {
+            return static_cast<SolverAnswer>(solve(stream));
+        });
+    }
+};
+
+// Term of a single line, for solvers whose answer is the sum of independent terms of their lines.
+using LineTerm = std::function<SolverAnswer (std::string_view)>;
+using LineTerms = std::map<SolverId, LineTerm>;
+
+const LineTerms& get_line_terms();
+
+void register_line_term(SolverId, LineTerm);
+
+class LineTermRegistration
+{
+public:
+    template <typename Answer>
+    LineTermRegistration(unsigned day, unsigned part, Answer (*get_term)(std::string_view))
+    {
+        register_line_term(SolverId{day, part}, [get_term](std::string_view line) {
+            return static_cast<SolverAnswer>(get_term(line));
+        });
+    }
+};
+} // namespace utility
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "utility/Hash.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace utility
+{
+// Identifies an answer: the solver, the build of the executable and the input it was given.
+struct ResultCacheKey
+{
+    std::string_view solver;
+    std::uint64_t input_hash;
+    std::uint64_t input_size;
+};
+
+// Identity of an input file, which changes whenever the file is written or replaced.
+struct FileStamp
+{
+    std::uint64_t device, inode, size, modification_time, change_time;
+
+    bool operator==(const FileStamp&) const = default;
+};
+
+std::optional<FileStamp> read_file_stamp(const std::string& filename);
+
+// Enables caching of answers in the directory, which is created when missing with access for the user only, or leaves
+// it disabled when the directory cannot be created. Least recently used answers are removed once the cache takes
+// more than `size_limit` bytes.
+void enable_result_cache(const std::filesystem::path& directory, std::uintmax_t size_limit);
+
+bool is_result_cache_enabled();
+
+// `aoc-result-cache` in $XDG_CACHE_HOME, or in ~/.cache when it is not set.
+std::filesystem::path get_default_result_cache_directory();
+
+constexpr std::uintmax_t default_result_cache_size_limit{4 * 1024 * 1024};
+
+// GNU build id of the executable in hex, or a digest of its size and modification time when it has none.
+std::string_view get_build_id();
+
+ResultCacheKey make_result_cache_key(std::string_view solver, const TextHasher& input_hasher);
+
+// Answer stored for the key, which also marks it as recently used.
+std::optional<std::string> find_cached_result(const ResultCacheKey&);
+
+// Stores the answer of the key. Failures are only logged, as the cache is an optimisation.
+void store_cached_result(const ResultCacheKey&, std::string_view answer);
+
+// Key of the input which the file with the stamp held when `store_cached_key` was called for it, so that inputs
+// which are only hashed while they are solved can be looked up without reading them.
+std::optional<ResultCacheKey> find_cached_key(std::string_view solver, const FileStamp&);
+
+// Stores the hash and size of the key for the file with the stamp. Failures are only logged.
+void store_cached_key(const ResultCacheKey&, const FileStamp&);
+} // namespace utility
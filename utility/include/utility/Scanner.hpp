@@ -0,0 +1,292 @@
+#pragma once
+
+#include "utility/Tokenizer.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace utility
+{
+// Line format used as a template argument, for example "Card {u}: {list} | {list}".
+// Placeholders:
+//   {u}    - unsigned integer (unsigned long)
+//   {i}    - signed integer (long)
+//   {s}    - text up to the next literal (std::string_view)
+//   {list} - text up to the next literal, exposed as utility::Integers<unsigned long>
+// A space in the format matches any number of spaces, other characters are matched exactly.
+template <std::size_t N>
+struct Format
+{
+    char characters[N]{};
+
+    constexpr Format(const char (&string)[N])
+    {
+        std::copy_n(string, N, characters);
+    }
+
+    constexpr std::string_view view() const
+    {
+        return std::string_view{characters, N - 1};
+    }
+};
+
+namespace scanner
+{
+enum class Kind
+{
+    literal, unsigned_integer, signed_integer, text, list
+};
+
+struct Token
+{
+    Kind kind;
+    std::size_t begin, length;
+};
+
+consteval Kind to_kind(std::string_view name)
+{
+    if (name == "u")
+    {
+        return Kind::unsigned_integer;
+    }
+    if (name == "i")
+    {
+        return Kind::signed_integer;
+    }
+    if (name == "s")
+    {
+        return Kind::text;
+    }
+    if (name == "list")
+    {
+        return Kind::list;
+    }
+    throw std::invalid_argument{"Unknown placeholder in format"};
+}
+
+template <typename Visitor>
+consteval void visit_tokens(std::string_view format, Visitor&& visitor)
+{
+    auto previous_kind = Kind::literal;
+    auto pos = std::size_t{0};
+    while (pos < format.size())
+    {
+        auto token = Token{Kind::literal, pos, 0};
+        if (format[pos] == '{')
+        {
+            const auto closing_pos = format.find('}', pos);
+            if (closing_pos == std::string_view::npos)
+            {
+                throw std::invalid_argument{"Unterminated placeholder in format"};
+            }
+            token.kind = to_kind(format.substr(pos + 1, closing_pos - pos - 1));
+            if (previous_kind != Kind::literal)
+            {
+                throw std::invalid_argument{"Placeholders must be separated by a literal"};
+            }
+            pos = closing_pos + 1;
+        }
+        else
+        {
+            pos = std::min(format.find('{', pos), format.size());
+            token.length = pos - token.begin;
+        }
+        previous_kind = token.kind;
+        visitor(token);
+    }
+}
+
+consteval std::size_t count_tokens(std::string_view format)
+{
+    auto count = std::size_t{0};
+    visit_tokens(format, [&count](const Token&) { ++count; });
+    return count;
+}
+
+template <std::size_t Count>
+consteval std::array<Token, Count> tokenize(std::string_view format)
+{
+    std::array<Token, Count> tokens{};
+    auto index = std::size_t{0};
+    visit_tokens(format, [&](const Token& token) { tokens[index++] = token; });
+    return tokens;
+}
+
+template <std::size_t Count>
+consteval std::size_t count_fields(const std::array<Token, Count>& tokens)
+{
+    const auto is_field = [](const Token& token) { return token.kind != Kind::literal; };
+    return static_cast<std::size_t>(std::ranges::count_if(tokens, is_field));
+}
+
+template <Kind kind>
+struct Field;
+
+template <>
+struct Field<Kind::unsigned_integer> { using Type = unsigned long; };
+
+template <>
+struct Field<Kind::signed_integer> { using Type = long; };
+
+template <>
+struct Field<Kind::text> { using Type = std::string_view; };
+
+template <>
+struct Field<Kind::list> { using Type = Integers<unsigned long>; };
+
+template <Format format>
+struct Layout
+{
+    static constexpr auto tokens = tokenize<count_tokens(format.view())>(format.view());
+
+    static constexpr auto fields = []() {
+        std::array<Kind, count_fields(tokens)> kinds{};
+        auto index = std::size_t{0};
+        for (const auto& token : tokens)
+        {
+            if (token.kind != Kind::literal)
+            {
+                kinds[index++] = token.kind;
+            }
+        }
+        return kinds;
+    }();
+
+    template <std::size_t... indices>
+    static auto make_result(std::index_sequence<indices...>)
+        -> std::tuple<typename Field<fields[indices]>::Type...>;
+
+    using Result = decltype(make_result(std::make_index_sequence<fields.size()>{}));
+};
+
+[[noreturn]] void throw_mismatch(std::string_view line, std::string_view format);
+
+inline std::size_t skip_spaces(std::string_view line, std::size_t pos)
+{
+    while (pos < line.size() and line[pos] == ' ')
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+// Returns the position right after the literal or npos when it does not match.
+inline std::size_t match_literal(std::string_view line, std::size_t pos, std::string_view literal)
+{
+    for (const auto c : literal)
+    {
+        if (c == ' ')
+        {
+            pos = skip_spaces(line, pos);
+        }
+        else if (pos < line.size() and line[pos] == c)
+        {
+            ++pos;
+        }
+        else
+        {
+            return std::string_view::npos;
+        }
+    }
+    return pos;
+}
+
+// Returns the position where the literal starts matching or npos when it does not occur.
+inline std::size_t find_literal(std::string_view line, std::size_t pos, std::string_view literal)
+{
+    const auto anchor_offset = literal.find_first_not_of(' ');
+    if (anchor_offset == std::string_view::npos)
+    {
+        return line.find(' ', pos);
+    }
+    const auto anchor = literal[anchor_offset];
+    for (auto anchor_pos = line.find(anchor, pos); anchor_pos != std::string_view::npos;
+         anchor_pos = line.find(anchor, anchor_pos + 1))
+    {
+        auto begin = anchor_pos;
+        if (anchor_offset > 0)
+        {
+            while (begin > pos and line[begin - 1] == ' ')
+            {
+                --begin;
+            }
+        }
+        if (match_literal(line, begin, literal) != std::string_view::npos)
+        {
+            return begin;
+        }
+    }
+    return std::string_view::npos;
+}
+
+template <Format format, std::size_t token_index, std::size_t field_index>
+void scan_tokens(std::string_view line, std::size_t pos, typename Layout<format>::Result& result)
+{
+    constexpr auto& tokens = Layout<format>::tokens;
+    if constexpr (token_index == tokens.size())
+    {
+        if (pos != line.size())
+        {
+            throw_mismatch(line, format.view());
+        }
+    }
+    else
+    {
+        constexpr auto token = tokens[token_index];
+        if constexpr (token.kind == Kind::literal)
+        {
+            constexpr auto literal = format.view().substr(token.begin, token.length);
+            pos = match_literal(line, pos, literal);
+            if (pos == std::string_view::npos)
+            {
+                throw_mismatch(line, format.view());
+            }
+            scan_tokens<format, token_index + 1, field_index>(line, pos, result);
+        }
+        else if constexpr (token.kind == Kind::unsigned_integer or token.kind == Kind::signed_integer)
+        {
+            auto& value = std::get<field_index>(result);
+            const auto [end, error] = std::from_chars(line.data() + pos, line.data() + line.size(), value);
+            if (error != std::errc{})
+            {
+                throw_mismatch(line, format.view());
+            }
+            pos = static_cast<std::size_t>(end - line.data());
+            scan_tokens<format, token_index + 1, field_index + 1>(line, pos, result);
+        }
+        else
+        {
+            auto end = line.size();
+            if constexpr (token_index + 1 < tokens.size())
+            {
+                constexpr auto next_token = tokens[token_index + 1];
+                constexpr auto next_literal = format.view().substr(next_token.begin, next_token.length);
+                end = find_literal(line, pos, next_literal);
+                if (end == std::string_view::npos)
+                {
+                    throw_mismatch(line, format.view());
+                }
+            }
+            using Type = std::tuple_element_t<field_index, typename Layout<format>::Result>;
+            std::get<field_index>(result) = Type{line.substr(pos, end - pos)};
+            scan_tokens<format, token_index + 1, field_index + 1>(line, end, result);
+        }
+    }
+}
+} // namespace scanner
+
+// Splits a line according to a format checked at compile time and returns the fields as a tuple.
+// Throws std::invalid_argument when the line does not match.
+template <Format format>
+typename scanner::Layout<format>::Result scan(std::string_view line)
+{
+    typename scanner::Layout<format>::Result result{};
+    scanner::scan_tokens<format, 0, 0>(line, 0, result);
+    return result;
+}
+} // namespace utility
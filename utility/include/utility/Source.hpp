@@ -0,0 +1,49 @@
+#pragma once
+
+#include "utility/Hash.hpp"
+#include <istream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace utility
+{
+class Source
+{
+public:
+    virtual ~Source() = default;
+
+    // Returns the next chunk of input or an empty view once the input is exhausted.
+    // The chunk stays valid until the next call.
+    virtual std::string_view read() = 0;
+};
+
+class IstreamSource : public Source
+{
+public:
+    IstreamSource(std::istream&);
+
+    std::string_view read() override;
+
+private:
+    std::istream& stream;
+    std::vector<char> buffer;
+};
+
+// Hands out the chunks of another source and feeds them to a hasher, so that the input is hashed while it is read.
+class HashingSource : public Source
+{
+public:
+    HashingSource(std::unique_ptr<Source>, TextHasher&);
+
+    std::string_view read() override;
+
+    // Hashes the rest of the input, which was not read.
+    void drain();
+
+private:
+    std::unique_ptr<Source> source;
+    TextHasher& hasher;
+    bool is_exhausted;
+};
+} // namespace utility
@@ -1,20 +1,26 @@
 #pragma once
 
-#include <string>
+#include "utility/Source.hpp"
 #include <iterator>
 #include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace utility
 {
+class Stream;
+
 struct StreamSentinel {};
 
 class StreamIterator
 {
 public:
     using difference_type = std::ptrdiff_t;
-    using value_type = std::string;
+    using value_type = std::string_view;
 
-    StreamIterator(std::istream&);
+    StreamIterator(Stream&);
 
     StreamIterator();
 
@@ -24,28 +30,36 @@ public:
 
     StreamIterator& operator++();
 
-    StreamIterator operator++(int);
+    void operator++(int);
 
     friend bool operator==(const StreamSentinel&, const StreamIterator&);
 
     friend bool operator!=(const StreamSentinel&, const StreamIterator&);
 
 private:
-    std::istream* stream;
-    std::string current_line;
+    Stream* stream;
     bool is_end_of_stream;
 
     void read();
 };
 
+// Splits input into lines without copying them. A line handed out stays valid until the next line is read,
+// unless the stream is created over a buffer, in which case it lives as long as the buffer. Lines are handed out
+// without a trailing carriage return, and a newline at the end of the input does not start another, empty line.
 class Stream
 {
 public:
     Stream(std::istream&);
 
+    Stream(std::string_view);
+
+    Stream(Source&);
+
+    Stream(std::unique_ptr<Source>);
+
     bool is_active() const;
 
-    std::string next_line();
+    std::string_view next_line();
 
     void skip(unsigned = 1);
 
@@ -53,7 +67,19 @@ public:
 
     StreamSentinel end();
 
+    // Hands out all unread input at once when it is already in memory and marks the stream as fully read.
+    std::optional<std::string_view> take_buffer();
+
 private:
-    std::istream& stream;
+    friend class StreamIterator;
+
+    std::unique_ptr<Source> owned_source;
+    Source* source;
+    std::string_view chunk;
+    std::string carry;
+    std::string_view current_line;
+    bool is_last_line_read;
+
+    bool read();
 };
 } // namespace utility
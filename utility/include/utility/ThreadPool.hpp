@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace utility
+{
+// Pool of worker threads, each with its own deque of tasks. A worker takes its newest task first and, once it runs
+// out, steals the oldest task of another worker. Threads waiting for a TaskGroup run queued tasks meanwhile, so
+// groups can be nested and a pool of `thread_count` threads has `thread_count - 1` workers besides the waiter.
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(unsigned thread_count);
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    unsigned get_thread_count() const { return static_cast<unsigned>(queues.size()) + 1; }
+
+    // Queues the task on the deque of the calling worker, or spreads tasks of other threads over the workers. While
+    // timings are enabled, the task runs inside the phases of the submitting thread.
+    void submit(Task);
+
+    // Runs one queued task on the calling thread, if there is any.
+    bool run_pending_task();
+
+    // Pool shared by the parallel algorithms. Its thread count is taken from the AOC_THREADS environment variable,
+    // otherwise from the hardware, unless it was set before the first use.
+    static ThreadPool& get_default();
+
+    static void set_default_thread_count(unsigned);
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void work(std::stop_token, std::size_t index);
+
+    std::optional<Task> take_task(std::size_t first_index);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::atomic<std::size_t> next_queue{0};
+    std::mutex wake_mutex;
+    std::condition_variable_any wake_condition;
+    std::size_t queued_count{0};
+    std::vector<std::jthread> workers;
+};
+
+// Counts the tasks submitted through it, so that their submitter can wait for all of them. The first exception
+// thrown by a task is rethrown by `wait`.
+class TaskGroup
+{
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::get_default()) : pool{pool} {}
+
+    TaskGroup(const TaskGroup&) = delete;
+
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() { wait_for_tasks(); }
+
+    template <typename Function>
+    void run(Function&& function)
+    {
+        start_task();
+        pool.submit([this, function = std::forward<Function>(function)]() mutable {
+            try
+            {
+                function();
+            }
+            catch (...)
+            {
+                finish_task(std::current_exception());
+                return;
+            }
+            finish_task(nullptr);
+        });
+    }
+
+    // Returns when every task of the group has finished, running queued tasks of the pool until then.
+    void wait();
+
+private:
+    void start_task();
+
+    void finish_task(std::exception_ptr);
+
+    void wait_for_tasks();
+
+    ThreadPool& pool;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t pending_count{0};
+    std::exception_ptr exception;
+};
+
+// Size of chunks which gives every thread of the pool a few of them, so that uneven chunks balance out.
+std::size_t get_default_chunk_size(std::size_t count, const ThreadPool&);
+
+// Folds `function(index)` of every index in [begin, end) into a single value. Indices are split into chunks reduced
+// on the threads of the pool, and the partial results are merged in order, so `merge` only has to be associative.
+// A chunk size of 0 picks one from the size of the range and the pool, and ranges not longer than a chunk are
+// reduced on the calling thread.
+template <typename T, typename Function, typename Merge = std::plus<>>
+T parallel_reduce(
+    std::size_t begin,
+    std::size_t end,
+    T init,
+    Function&& function,
+    Merge&& merge = {},
+    std::size_t chunk_size = 0,
+    ThreadPool& pool = ThreadPool::get_default())
+{
+    const auto count = end > begin ? end - begin : 0;
+    chunk_size = chunk_size == 0 ? get_default_chunk_size(count, pool) : chunk_size;
+    const auto reduce_chunk = [&function, &merge](std::size_t chunk_begin, std::size_t chunk_end) {
+        std::optional<T> partial;
+        for (auto index = chunk_begin; index < chunk_end; ++index)
+        {
+            partial = partial.has_value() ? merge(std::move(*partial), function(index)) : T(function(index));
+        }
+        return partial;
+    };
+    if (count <= chunk_size or pool.get_thread_count() == 1)
+    {
+        auto partial = reduce_chunk(begin, end);
+        return partial.has_value() ? merge(std::move(init), std::move(*partial)) : init;
+    }
+
+    const auto chunk_count = (count + chunk_size - 1) / chunk_size;
+    std::vector<std::optional<T>> partials(chunk_count);
+    TaskGroup group{pool};
+    for (std::size_t chunk{0}; chunk < chunk_count; ++chunk)
+    {
+        group.run([&reduce_chunk, &partials, chunk, begin, end, chunk_size]() {
+            const auto chunk_begin = begin + chunk * chunk_size;
+            partials[chunk] = reduce_chunk(chunk_begin, std::min(chunk_begin + chunk_size, end));
+        });
+    }
+    group.wait();
+    for (auto& partial : partials)
+    {
+        if (partial.has_value())
+        {
+            init = merge(std::move(init), std::move(*partial));
+        }
+    }
+    return init;
+}
+
+// Calls `function(index)` for every index in [begin, end), split into chunks like in `parallel_reduce`.
+template <typename Function>
+void parallel_for(
+    std::size_t begin,
+    std::size_t end,
+    Function&& function,
+    std::size_t chunk_size = 0,
+    ThreadPool& pool = ThreadPool::get_default())
+{
+    struct Nothing {};
+    const auto call = [&function](std::size_t index) {
+        function(index);
+        return Nothing{};
+    };
+    const auto ignore = [](Nothing, Nothing) { return Nothing{}; };
+    parallel_reduce(begin, end, Nothing{}, call, ignore, chunk_size, pool);
+}
+} // namespace utility
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "utility/Allocation.hpp"
+#include "utility/PerfCounters.hpp"
+#include "utility/Trace.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utility
+{
+// Measures wall time and CPU time of the calling thread between its construction and destruction and adds them to
+// the phase named after the enclosing timers, for example "solve/parse_map". While allocation tracking is enabled it
+// also measures the allocations made meanwhile, and while hardware counters are enabled their increments. While
+// timings are disabled it only tests a flag. While tracing is enabled it also records its span in the trace of the
+// thread.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(std::string_view phase) : phase{phase}
+    {
+        if (is_enabled())
+        {
+            start();
+        }
+        if (is_tracing_enabled())
+        {
+            trace_begin = TraceClock::now();
+            is_traced = true;
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    ~ScopedTimer()
+    {
+        if (is_traced)
+        {
+            record_trace_event(phase, trace_begin, TraceClock::now());
+        }
+        if (is_started)
+        {
+            stop();
+        }
+    }
+
+    static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+    static void set_enabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+
+private:
+    static inline std::atomic<bool> enabled{false};
+
+    void start();
+
+    void stop();
+
+    std::string_view phase;
+    bool is_started{false}, is_traced{false};
+    TraceClock::time_point trace_begin;
+    std::size_t phase_index, parent_path_length;
+    std::chrono::steady_clock::time_point wall_start;
+    std::chrono::nanoseconds cpu_start;
+    AllocationCounters allocation_start;
+    long long previous_peak;
+    PerfCounterValues counters_start;
+};
+
+// Phases running on a thread, which tasks submitted to another thread carry along as their enclosing phases.
+struct PhaseContext
+{
+    std::string path;
+    unsigned depth{0};
+};
+
+PhaseContext get_phase_context();
+
+// Makes the given phases the enclosing ones of the timers on the calling thread during its lifetime.
+class ScopedPhaseContext
+{
+public:
+    explicit ScopedPhaseContext(PhaseContext);
+
+    ScopedPhaseContext(const ScopedPhaseContext&) = delete;
+
+    ScopedPhaseContext& operator=(const ScopedPhaseContext&) = delete;
+
+    ~ScopedPhaseContext();
+
+private:
+    PhaseContext previous;
+};
+
+// Allocations made by all threads while a phase was running. Peak is the highest amount of live bytes above the
+// amount at the start of the phase.
+struct PhaseAllocations
+{
+    unsigned long long allocations{0}, allocated_bytes{0};
+    long long peak_bytes{0};
+};
+
+struct PhaseTiming
+{
+    std::string name;
+    unsigned depth;
+    unsigned long long calls;
+    std::chrono::nanoseconds wall_time, cpu_time;
+    PhaseAllocations allocations{};
+    PerfCounterValues counters{};
+};
+
+// Phases in the order in which they were first entered.
+std::vector<PhaseTiming> get_phase_timings();
+
+enum class TimingFormat
+{
+    text, json
+};
+
+TimingFormat parse_timing_format(std::string_view);
+
+void print_timings(std::ostream&, TimingFormat);
+} // namespace utility
+
+#define TIMER_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define TIMER_CONCAT(lhs, rhs) TIMER_CONCAT_IMPL(lhs, rhs)
+
+#ifdef AOC_DISABLE_TIMINGS
+#define TIME_SCOPE(phase) static_cast<void>(0)
+#else
+#define TIME_SCOPE(phase) const utility::ScopedTimer TIMER_CONCAT(scoped_timer_, __LINE__){phase}
+#endif
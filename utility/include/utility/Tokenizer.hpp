@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace utility
+{
+// Returns the first digit (or minus sign when `is_signed` is set) in the range, `last` if there is none.
+const char* find_integer_start(const char* first, const char* last, bool is_signed);
+
+template <std::integral T>
+class IntegerIterator
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+
+    IntegerIterator(std::string_view string) : current{string.data()}, last{string.data() + string.size()}
+    {
+        read();
+    }
+
+    IntegerIterator() : current{nullptr}, last{nullptr}, value{}, is_end{true} {}
+
+    const value_type& operator*() const { return value; }
+
+    IntegerIterator& operator++()
+    {
+        read();
+        return *this;
+    }
+
+    void operator++(int) { read(); }
+
+    friend bool operator==(const IntegerIterator& itr, std::default_sentinel_t) { return itr.is_end; }
+
+private:
+    const char* current;
+    const char* last;
+    value_type value;
+    bool is_end;
+
+    void read()
+    {
+        while (true)
+        {
+            current = find_integer_start(current, last, std::is_signed_v<T>);
+            if (current == last)
+            {
+                is_end = true;
+                return;
+            }
+            const auto [end, error] = std::from_chars(current, last, value);
+            if (error == std::errc{})
+            {
+                current = end;
+                is_end = false;
+                return;
+            }
+            if (error == std::errc::result_out_of_range)
+            {
+                throw std::out_of_range{"Integer does not fit into its type"};
+            }
+            ++current;
+        }
+    }
+};
+
+// Range over all integers found in a string, without allocating.
+template <std::integral T>
+class Integers
+{
+public:
+    Integers() = default;
+
+    Integers(std::string_view string) : string{string}
+    {
+    }
+
+    IntegerIterator<T> begin() const { return IntegerIterator<T>{string}; }
+
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    std::string_view string;
+};
+
+template <std::integral T, std::size_t N>
+std::array<T, N> parse_integers(std::string_view string)
+{
+    std::array<T, N> result;
+    auto itr = IntegerIterator<T>{string};
+    for (auto& value : result)
+    {
+        if (itr == std::default_sentinel)
+        {
+            throw std::invalid_argument{"Not enough integers in a string"};
+        }
+        value = *itr;
+        ++itr;
+    }
+    return result;
+}
+} // namespace utility
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace utility
+{
+using TraceClock = std::chrono::steady_clock;
+
+bool is_tracing_enabled();
+
+void set_tracing_enabled(bool);
+
+// Adds a span to the buffer of the calling thread. Each thread only appends to its own buffer, so recording takes
+// no lock apart from the first event of a thread. The name has to outlive the trace, as string literals do.
+void record_trace_event(std::string_view name, TraceClock::time_point begin, TraceClock::time_point end);
+
+// Writes the spans of all threads as Chrome Trace Event JSON, which chrome://tracing and Perfetto open. Must be
+// called after the threads which recorded them have finished.
+void write_trace(std::ostream&);
+
+void write_trace(const std::string& filename);
+} // namespace utility
@@ -0,0 +1,183 @@
+#include "utility/Allocation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <malloc.h>
+
+namespace utility
+{
+namespace
+{
+std::atomic<bool> enabled{false};
+std::atomic<unsigned long long> allocations{0}, deallocations{0}, allocated_bytes{0};
+std::atomic<long long> live_bytes{0}, peak_live_bytes{0};
+
+void raise_peak(long long value)
+{
+    auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (peak < value and not peak_live_bytes.compare_exchange_weak(peak, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+[[maybe_unused]] void count_allocation(void* pointer)
+{
+    if (not enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    const auto size = static_cast<long long>(::malloc_usable_size(pointer));
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(static_cast<unsigned long long>(size), std::memory_order_relaxed);
+    raise_peak(live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+[[maybe_unused]] void count_deallocation(void* pointer)
+{
+    if (pointer == nullptr or not enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    deallocations.fetch_add(1, std::memory_order_relaxed);
+    live_bytes.fetch_sub(static_cast<long long>(::malloc_usable_size(pointer)), std::memory_order_relaxed);
+}
+} // namespace
+
+bool is_allocation_tracking_available()
+{
+#ifdef AOC_DISABLE_ALLOCATION_TRACKING
+    return false;
+#else
+    return true;
+#endif
+}
+
+bool is_allocation_tracking_enabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void set_allocation_tracking_enabled(bool value)
+{
+    enabled.store(value and is_allocation_tracking_available(), std::memory_order_relaxed);
+}
+
+AllocationCounters get_allocation_counters()
+{
+    return AllocationCounters{
+        allocations.load(std::memory_order_relaxed),
+        deallocations.load(std::memory_order_relaxed),
+        allocated_bytes.load(std::memory_order_relaxed),
+        live_bytes.load(std::memory_order_relaxed),
+    };
+}
+
+long long begin_peak_measurement()
+{
+    return peak_live_bytes.exchange(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+long long end_peak_measurement(long long previous_peak)
+{
+    const auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+    raise_peak(previous_peak);
+    return peak;
+}
+} // namespace utility
+
+#ifndef AOC_DISABLE_ALLOCATION_TRACKING
+namespace
+{
+void* allocate(std::size_t size)
+{
+    auto* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    utility::count_allocation(pointer);
+    return pointer;
+}
+
+void* allocate(std::size_t size, std::align_val_t alignment)
+{
+    void* pointer = nullptr;
+    const auto alignment_value = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+    if (::posix_memalign(&pointer, alignment_value, size == 0 ? 1 : size) != 0)
+    {
+        throw std::bad_alloc{};
+    }
+    utility::count_allocation(pointer);
+    return pointer;
+}
+
+void deallocate(void* pointer) noexcept
+{
+    utility::count_deallocation(pointer);
+    std::free(pointer);
+}
+} // namespace
+
+// Replacements of the global allocation functions, which every other form of operator new and delete ends up in.
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+#endif
@@ -0,0 +1,51 @@
+#include "utility/Arena.hpp"
+#include <memory_resource>
+
+namespace utility
+{
+namespace
+{
+thread_local std::pmr::memory_resource* current_resource = nullptr;
+} // namespace
+
+Arena::Arena(Mode mode, std::size_t initial_size) : buffer{initial_size}
+{
+    if (mode == Mode::pooled)
+    {
+        pool.emplace(&buffer);
+    }
+}
+
+std::pmr::memory_resource* Arena::get_resource()
+{
+    if (pool.has_value())
+    {
+        return &*pool;
+    }
+    return &buffer;
+}
+
+void Arena::release()
+{
+    if (pool.has_value())
+    {
+        pool->release();
+    }
+    buffer.release();
+}
+
+ArenaScope::ArenaScope(Arena& arena) : previous_resource{current_resource}
+{
+    current_resource = arena.get_resource();
+}
+
+ArenaScope::~ArenaScope()
+{
+    current_resource = previous_resource;
+}
+
+std::pmr::memory_resource* get_current_resource()
+{
+    return current_resource != nullptr ? current_resource : std::pmr::get_default_resource();
+}
+} // namespace utility
@@ -1,9 +1,15 @@
 #include "utility/Arguments.hpp"
 #include "utility/Dbg.hpp"
+#include "utility/MappedFile.hpp"
+#include <algorithm>
 #include <fstream>
 #include <exception>
 #include <filesystem>
+#include <functional>
+#include <optional>
+#include <ranges>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace utility
@@ -19,15 +25,22 @@ Arguments parse_arguments(int argc, char* argv[])
     return arguments;
 }
 
+namespace
+{
+bool is_option(std::string_view argument)
+{
+    return argument.starts_with("--");
+}
+} // namespace
+
 std::string get_input_filename(const Arguments& args)
 {
-    constexpr auto expected_arg_count = 2u;
-    const auto args_count = args.size();
-    if (args_count < expected_arg_count)
+    auto positional_args = args | std::views::drop(1) | std::views::filter(std::not_fn(is_option));
+    if (positional_args.empty())
     {
         throw std::invalid_argument{"No input filename provided"};
     }
-    const auto input_filename = args[1];
+    const auto input_filename = positional_args.front();
     if (not std::filesystem::exists(input_filename))
     {
         throw std::invalid_argument{CONCAT("Input file ", std::quoted(input_filename), " does not exist")};
@@ -35,6 +48,55 @@ std::string get_input_filename(const Arguments& args)
     return input_filename;
 }
 
+std::vector<std::string> get_input_filenames(const Arguments& args)
+{
+    std::vector<std::string> input_filenames;
+    for (const auto& argument : args | std::views::drop(1) | std::views::filter(std::not_fn(is_option)))
+    {
+        if (not std::filesystem::is_directory(argument))
+        {
+            if (not std::filesystem::exists(argument))
+            {
+                throw std::invalid_argument{CONCAT("Input file ", std::quoted(argument), " does not exist")};
+            }
+            input_filenames.push_back(argument);
+            continue;
+        }
+        std::vector<std::string> directory_filenames;
+        for (const auto& file : std::filesystem::directory_iterator{argument})
+        {
+            if (file.is_regular_file())
+            {
+                directory_filenames.push_back(file.path().string());
+            }
+        }
+        std::ranges::sort(directory_filenames);
+        input_filenames.insert(input_filenames.end(), directory_filenames.begin(), directory_filenames.end());
+    }
+    if (input_filenames.empty())
+    {
+        throw std::invalid_argument{"No input filename provided"};
+    }
+    return input_filenames;
+}
+
+std::optional<std::string> get_option(const Arguments& args, std::string_view name)
+{
+    for (const std::string_view argument : args | std::views::drop(1) | std::views::filter(is_option))
+    {
+        const auto option = argument.substr(2);
+        if (option == name)
+        {
+            return std::string{};
+        }
+        if (option.starts_with(name) and option.substr(name.size()).starts_with('='))
+        {
+            return std::string{option.substr(name.size() + 1)};
+        }
+    }
+    return std::nullopt;
+}
+
 std::ifstream open_file(const std::string& filename)
 {
     std::ifstream stream;
@@ -45,5 +107,10 @@ std::ifstream open_file(const std::string& filename)
     }
     return stream;
 }
+
+MappedFile map_file(const std::string& filename)
+{
+    return MappedFile{filename};
+}
 } // namespace utility
 
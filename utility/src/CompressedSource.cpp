@@ -0,0 +1,278 @@
+#include "utility/CompressedSource.hpp"
+#include "utility/Dbg.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#ifdef AOC_HAVE_ZLIB
+    #include <zlib.h>
+#endif
+#ifdef AOC_HAVE_ZSTD
+    #include <zstd.h>
+#endif
+
+namespace utility
+{
+namespace
+{
+constexpr std::array<unsigned char, 2> gzip_magic{0x1f, 0x8b};
+constexpr std::array<unsigned char, 4> zstd_magic{0x28, 0xb5, 0x2f, 0xfd};
+
+template <std::size_t size>
+bool starts_with(std::string_view bytes, const std::array<unsigned char, size>& magic)
+{
+    return bytes.size() >= size and std::memcmp(bytes.data(), magic.data(), size) == 0;
+}
+
+using Decompressor = DecompressingSource::Decompressor;
+
+#ifdef AOC_HAVE_ZLIB
+class GzipDecompressor : public Decompressor
+{
+public:
+    explicit GzipDecompressor(Source& input) : input{input}
+    {
+        std::memset(&stream, 0, sizeof(stream));
+        constexpr auto max_window_bits = 15;
+        constexpr auto detect_header = 32;
+        if (::inflateInit2(&stream, max_window_bits + detect_header) != Z_OK)
+        {
+            throw std::logic_error{"Gzip decompression could not be started"};
+        }
+    }
+
+    ~GzipDecompressor() override
+    {
+        ::inflateEnd(&stream);
+    }
+
+    std::size_t decompress(char* buffer, std::size_t size) override
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer);
+        stream.avail_out = static_cast<uInt>(size);
+        while (stream.avail_out > 0)
+        {
+            if (stream.avail_in == 0)
+            {
+                const auto chunk = input.read();
+                if (chunk.empty())
+                {
+                    if (not is_member_finished)
+                    {
+                        throw std::logic_error{"Gzip input is truncated"};
+                    }
+                    break;
+                }
+                stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+                stream.avail_in = static_cast<uInt>(chunk.size());
+            }
+            if (is_member_finished)
+            {
+                // Concatenated gzip files decompress to the concatenation of their contents.
+                ::inflateReset(&stream);
+                is_member_finished = false;
+            }
+            const auto result = ::inflate(&stream, Z_NO_FLUSH);
+            if (result == Z_STREAM_END)
+            {
+                is_member_finished = true;
+            }
+            else if (result != Z_OK and result != Z_BUF_ERROR)
+            {
+                throw std::logic_error{"Gzip input is corrupted: " + std::string{stream.msg ? stream.msg : "unknown"}};
+            }
+        }
+        return size - stream.avail_out;
+    }
+
+private:
+    Source& input;
+    z_stream stream;
+    bool is_member_finished{false};
+};
+#endif
+
+#ifdef AOC_HAVE_ZSTD
+class ZstdDecompressor : public Decompressor
+{
+public:
+    explicit ZstdDecompressor(Source& input) : input{input}, stream{::ZSTD_createDStream()}
+    {
+        if (stream == nullptr)
+        {
+            throw std::logic_error{"Zstd decompression could not be started"};
+        }
+        ::ZSTD_initDStream(stream);
+    }
+
+    ~ZstdDecompressor() override
+    {
+        ::ZSTD_freeDStream(stream);
+    }
+
+    std::size_t decompress(char* buffer, std::size_t size) override
+    {
+        ZSTD_outBuffer output{buffer, size, 0};
+        while (output.pos < output.size)
+        {
+            if (chunk.pos == chunk.size)
+            {
+                const auto data = input.read();
+                if (data.empty())
+                {
+                    if (not is_frame_finished)
+                    {
+                        throw std::logic_error{"Zstd input is truncated"};
+                    }
+                    break;
+                }
+                chunk = ZSTD_inBuffer{data.data(), data.size(), 0};
+            }
+            const auto result = ::ZSTD_decompressStream(stream, &output, &chunk);
+            if (::ZSTD_isError(result))
+            {
+                throw std::logic_error{"Zstd input is corrupted: " + std::string{::ZSTD_getErrorName(result)}};
+            }
+            is_frame_finished = result == 0;
+        }
+        return output.pos;
+    }
+
+private:
+    Source& input;
+    ZSTD_DStream* stream;
+    ZSTD_inBuffer chunk{nullptr, 0, 0};
+    bool is_frame_finished{true};
+};
+#endif
+
+std::unique_ptr<Decompressor> create_decompressor(Source& input, Compression compression)
+{
+    switch (compression)
+    {
+        case Compression::gzip:
+#ifdef AOC_HAVE_ZLIB
+            return std::make_unique<GzipDecompressor>(input);
+#else
+            throw std::logic_error{"Gzip support is not compiled in"};
+#endif
+        case Compression::zstd:
+#ifdef AOC_HAVE_ZSTD
+            return std::make_unique<ZstdDecompressor>(input);
+#else
+            throw std::logic_error{"Zstd support is not compiled in"};
+#endif
+        case Compression::none:
+            break;
+    }
+    throw std::invalid_argument{"Input is not compressed"};
+}
+} // namespace
+
+Compression detect_compression(const std::string& filename)
+{
+    std::ifstream file{filename, std::ios::binary};
+    std::array<char, zstd_magic.size()> bytes;
+    file.read(bytes.data(), bytes.size());
+    const auto header = std::string_view{bytes.data(), static_cast<std::size_t>(file.gcount())};
+    if (starts_with(header, gzip_magic))
+    {
+        return Compression::gzip;
+    }
+    if (starts_with(header, zstd_magic))
+    {
+        return Compression::zstd;
+    }
+    return Compression::none;
+}
+
+DecompressingSource::DecompressingSource(
+    std::unique_ptr<Source> compressed,
+    Compression compression,
+    std::size_t buffer_count,
+    std::size_t buffer_size)
+    : compressed{std::move(compressed)},
+      decompressor{create_decompressor(*this->compressed, compression)},
+      buffers(std::max<std::size_t>(buffer_count, 1)),
+      is_finished{false},
+      current{nullptr}
+{
+    for (auto& buffer : buffers)
+    {
+        buffer.data.resize(buffer_size);
+        free_buffers.push_back(&buffer);
+    }
+    worker = std::jthread{[this](std::stop_token stop_token) { decompress_all(stop_token); }};
+}
+
+DecompressingSource::~DecompressingSource()
+{
+    worker.request_stop();
+    condition.notify_all();
+}
+
+void DecompressingSource::decompress_all(std::stop_token stop_token)
+{
+    try
+    {
+        while (true)
+        {
+            Buffer* buffer;
+            {
+                std::unique_lock lock{mutex};
+                if (not condition.wait(lock, stop_token, [this] { return not free_buffers.empty(); }))
+                {
+                    return;
+                }
+                buffer = free_buffers.front();
+                free_buffers.pop_front();
+            }
+            buffer->size = decompressor->decompress(buffer->data.data(), buffer->data.size());
+            const std::scoped_lock lock{mutex};
+            if (buffer->size == 0)
+            {
+                is_finished = true;
+                condition.notify_all();
+                return;
+            }
+            filled_buffers.push_back(buffer);
+            condition.notify_all();
+        }
+    }
+    catch (...)
+    {
+        const std::scoped_lock lock{mutex};
+        exception = std::current_exception();
+        is_finished = true;
+        condition.notify_all();
+    }
+}
+
+std::string_view DecompressingSource::read()
+{
+    std::unique_lock lock{mutex};
+    if (current != nullptr)
+    {
+        free_buffers.push_back(std::exchange(current, nullptr));
+        condition.notify_all();
+    }
+    condition.wait(lock, [this] { return not filled_buffers.empty() or is_finished; });
+    if (filled_buffers.empty())
+    {
+        if (exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+        return {};
+    }
+    current = filled_buffers.front();
+    filled_buffers.pop_front();
+    return std::string_view{current->data.data(), current->size};
+}
+} // namespace utility
@@ -0,0 +1,91 @@
+#include "utility/CpuFeatures.hpp"
+#include "utility/Dbg.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <stdexcept>
+#include <string_view>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+#endif
+
+namespace utility
+{
+namespace
+{
+#if defined(__x86_64__) || defined(__i386__)
+constexpr auto sse2_bit = 1u << 26;
+constexpr auto osxsave_bit = 1u << 27;
+constexpr auto avx_bit = 1u << 28;
+constexpr auto avx2_bit = 1u << 5;
+// XMM and YMM registers saved by the operating system on context switches.
+constexpr auto ymm_state_mask = 0x6u;
+
+unsigned long long read_xcr0()
+{
+    unsigned eax, edx;
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+}
+
+Isa detect_isa()
+{
+    unsigned eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0 or (edx & sse2_bit) == 0)
+    {
+        return Isa::scalar;
+    }
+    const auto is_avx_enabled = (ecx & osxsave_bit) != 0 and (ecx & avx_bit) != 0
+        and (read_xcr0() & ymm_state_mask) == ymm_state_mask;
+    if (not is_avx_enabled or __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0 or (ebx & avx2_bit) == 0)
+    {
+        return Isa::sse2;
+    }
+    return Isa::avx2;
+}
+#else
+Isa detect_isa()
+{
+    return Isa::scalar;
+}
+#endif
+
+Isa parse_isa(std::string_view name)
+{
+    for (const auto isa : {Isa::scalar, Isa::sse2, Isa::avx2})
+    {
+        if (name == get_isa_name(isa))
+        {
+            return isa;
+        }
+    }
+    throw std::invalid_argument{CONCAT("Unknown instruction set ", std::quoted(name))};
+}
+} // namespace
+
+std::string_view get_isa_name(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::scalar: return "scalar";
+        case Isa::sse2: return "sse2";
+        case Isa::avx2: return "avx2";
+    }
+    return "unknown";
+}
+
+Isa get_supported_isa()
+{
+    static const auto isa = detect_isa();
+    return isa;
+}
+
+Isa get_selected_isa()
+{
+    static const auto isa = [] {
+        const auto* variable = std::getenv("AOC_ISA");
+        return variable == nullptr ? get_supported_isa() : std::min(parse_isa(variable), get_supported_isa());
+    }();
+    return isa;
+}
+} // namespace utility
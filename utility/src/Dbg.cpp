@@ -1,14 +1,37 @@
 #include "utility/Dbg.hpp"
 #include <ostream>
+#include <sstream>
+#include <string_view>
 
-std::string get_filename(std::string s)
+std::string_view get_filename(std::string_view path)
 {
-    const auto last_slash_pos = s.find_last_of('/');
-    if (last_slash_pos != std::string::npos)
+    const auto last_slash_pos = path.find_last_of('/');
+    return last_slash_pos == std::string_view::npos ? path : path.substr(last_slash_pos + 1);
+}
+
+namespace
+{
+thread_local std::ostringstream log_stream;
+} // namespace
+
+std::ostream& start_log_message(utility::LogLevel level, std::string_view file, int line)
+{
+    log_stream.str({});
+    log_stream << std::boolalpha << '[' << get_filename(file) << ':' << line << "] ";
+    if (level == utility::LogLevel::warning)
     {
-        s.erase(0, last_slash_pos + 1);
+        log_stream << "warning: ";
     }
-    return s;
+    else if (level == utility::LogLevel::error)
+    {
+        log_stream << "error: ";
+    }
+    return log_stream;
+}
+
+void finish_log_message(utility::LogLevel level)
+{
+    utility::write_log(level, log_stream.view());
 }
 
 template <>
@@ -0,0 +1,350 @@
+#include "utility/FileSource.hpp"
+#include "utility/CompressedSource.hpp"
+#include "utility/Dbg.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <linux/io_uring.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace utility
+{
+namespace
+{
+int open_for_reading(const std::string& filename)
+{
+    const auto fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::logic_error{CONCAT("File ", filename, " could not be open")};
+    }
+    return fd;
+}
+
+int io_uring_setup(unsigned entries, io_uring_params& params)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+unsigned load_acquire(unsigned* value)
+{
+    return std::atomic_ref<unsigned>{*value}.load(std::memory_order_acquire);
+}
+
+void store_release(unsigned* value, unsigned new_value)
+{
+    std::atomic_ref<unsigned>{*value}.store(new_value, std::memory_order_release);
+}
+} // namespace
+
+PreadSource::PreadSource(const std::string& filename, std::size_t buffer_size)
+    : fd{open_for_reading(filename)}, offset{0}, buffer(buffer_size)
+{
+}
+
+PreadSource::~PreadSource()
+{
+    ::close(fd);
+}
+
+std::string_view PreadSource::read()
+{
+    const auto count = ::pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+    if (count < 0)
+    {
+        throw std::logic_error{CONCAT("File could not be read: ", std::strerror(errno))};
+    }
+    offset += static_cast<std::size_t>(count);
+    return std::string_view{buffer.data(), static_cast<std::size_t>(count)};
+}
+
+// Submission and completion queues shared with the kernel, mapped the way io_uring_setup(2) describes.
+struct UringSource::Ring
+{
+    explicit Ring(unsigned entries)
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        fd = io_uring_setup(entries, params);
+        if (fd < 0)
+        {
+            throw std::logic_error{CONCAT("io_uring could not be set up: ", std::strerror(errno))};
+        }
+        sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            sq_size = cq_size = std::max(sq_size, cq_size);
+        }
+        sq_ring = map(sq_size, IORING_OFF_SQ_RING);
+        cq_ring = (params.features & IORING_FEAT_SINGLE_MMAP) ? sq_ring : map(cq_size, IORING_OFF_CQ_RING);
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(map(sqes_size, IORING_OFF_SQES));
+
+        auto* sq_bytes = static_cast<char*>(sq_ring);
+        sq_tail = reinterpret_cast<unsigned*>(sq_bytes + params.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned*>(sq_bytes + params.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned*>(sq_bytes + params.sq_off.array);
+        auto* cq_bytes = static_cast<char*>(cq_ring);
+        cq_head = reinterpret_cast<unsigned*>(cq_bytes + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq_bytes + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq_bytes + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq_bytes + params.cq_off.cqes);
+    }
+
+    Ring(const Ring&) = delete;
+
+    Ring& operator=(const Ring&) = delete;
+
+    ~Ring()
+    {
+        if (sqes != nullptr)
+        {
+            ::munmap(sqes, sqes_size);
+        }
+        if (cq_ring != nullptr and cq_ring != sq_ring)
+        {
+            ::munmap(cq_ring, cq_size);
+        }
+        if (sq_ring != nullptr)
+        {
+            ::munmap(sq_ring, sq_size);
+        }
+        ::close(fd);
+    }
+
+    void* map(std::size_t size, off_t offset)
+    {
+        auto* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        if (address == MAP_FAILED)
+        {
+            throw std::logic_error{CONCAT("io_uring could not be mapped: ", std::strerror(errno))};
+        }
+        return address;
+    }
+
+    void submit_read(int file_fd, char* buffer, std::size_t length, std::size_t offset, std::size_t user_data)
+    {
+        const auto tail = *sq_tail;
+        const auto index = tail & sq_mask;
+        auto& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = file_fd;
+        sqe.addr = reinterpret_cast<unsigned long long>(buffer);
+        sqe.len = static_cast<unsigned>(length);
+        sqe.off = offset;
+        sqe.user_data = user_data;
+        sq_array[index] = index;
+        store_release(sq_tail, tail + 1);
+        if (io_uring_enter(fd, 1, 0, 0) < 0)
+        {
+            throw std::logic_error{CONCAT("Read could not be submitted: ", std::strerror(errno))};
+        }
+    }
+
+    // Blocks until at least one read completes and returns it.
+    io_uring_cqe wait_for_completion()
+    {
+        while (load_acquire(cq_tail) == *cq_head)
+        {
+            if (io_uring_enter(fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 and errno != EINTR)
+            {
+                throw std::logic_error{CONCAT("Reads could not be awaited: ", std::strerror(errno))};
+            }
+        }
+        const auto head = *cq_head;
+        const auto completion = cqes[head & cq_mask];
+        store_release(cq_head, head + 1);
+        return completion;
+    }
+
+    int fd;
+    void* sq_ring{nullptr};
+    void* cq_ring{nullptr};
+    io_uring_sqe* sqes{nullptr};
+    std::size_t sq_size, cq_size, sqes_size;
+    unsigned* sq_tail;
+    unsigned* sq_array;
+    unsigned sq_mask;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned cq_mask;
+    io_uring_cqe* cqes;
+};
+
+UringSource::UringSource(const std::string& filename, unsigned buffer_count, std::size_t buffer_size)
+    : filename{filename},
+      fd{open_for_reading(filename)},
+      file_size{0},
+      next_offset{0},
+      current_slot{0},
+      is_slot_handed_out{false}
+{
+    struct stat status;
+    if (::fstat(fd, &status) != 0)
+    {
+        ::close(fd);
+        throw std::logic_error{CONCAT("File ", filename, " could not be inspected: ", std::strerror(errno))};
+    }
+    file_size = static_cast<std::size_t>(status.st_size);
+    try
+    {
+        ring = std::make_unique<Ring>(buffer_count);
+    }
+    catch (...)
+    {
+        ::close(fd);
+        throw;
+    }
+    slots.resize(std::max(buffer_count, 1u));
+    for (auto index = 0u; index < slots.size(); ++index)
+    {
+        slots[index].buffer.resize(buffer_size);
+        submit(index);
+    }
+}
+
+UringSource::~UringSource()
+{
+    // Reads still in flight write into the buffers, so they have to finish before anything is freed.
+    for (auto index = 0u; index < slots.size(); ++index)
+    {
+        try
+        {
+            wait_for(index);
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+    ring.reset();
+    ::close(fd);
+}
+
+// Assigns the next block of the file to the slot and starts reading it, unless the file is exhausted.
+void UringSource::submit(std::size_t slot_index)
+{
+    auto& slot = slots[slot_index];
+    slot.offset = next_offset;
+    slot.length = std::min(slot.buffer.size(), file_size - std::min(file_size, next_offset));
+    slot.filled = 0;
+    slot.is_complete = slot.length == 0;
+    next_offset += slot.length;
+    if (not slot.is_complete)
+    {
+        ring->submit_read(fd, slot.buffer.data(), slot.length, slot.offset, slot_index);
+    }
+}
+
+void UringSource::wait_for(std::size_t slot_index)
+{
+    while (not slots[slot_index].is_complete)
+    {
+        const auto completion = ring->wait_for_completion();
+        auto& slot = slots[completion.user_data];
+        if (completion.res < 0)
+        {
+            slot.is_complete = true;
+            throw std::logic_error{CONCAT("File ", filename, " could not be read: ", std::strerror(-completion.res))};
+        }
+        slot.filled += static_cast<std::size_t>(completion.res);
+        // A short read is continued where it stopped, unless the file ended sooner than expected.
+        if (completion.res == 0 or slot.filled == slot.length)
+        {
+            slot.is_complete = true;
+            continue;
+        }
+        ring->submit_read(
+            fd,
+            slot.buffer.data() + slot.filled,
+            slot.length - slot.filled,
+            slot.offset + slot.filled,
+            completion.user_data);
+    }
+}
+
+std::string_view UringSource::read()
+{
+    if (is_slot_handed_out)
+    {
+        submit(current_slot);
+        current_slot = (current_slot + 1) % slots.size();
+    }
+    wait_for(current_slot);
+    is_slot_handed_out = true;
+    const auto& slot = slots[current_slot];
+    return std::string_view{slot.buffer.data(), slot.filled};
+}
+
+bool UringSource::is_available()
+{
+    static const auto is_available = [] {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        const auto fd = io_uring_setup(1, params);
+        if (fd < 0)
+        {
+            return false;
+        }
+        ::close(fd);
+        return true;
+    }();
+    return is_available;
+}
+
+Reader parse_reader(std::string_view string)
+{
+    if (string.empty() or string == "mmap")
+    {
+        return Reader::mmap;
+    }
+    if (string == "uring")
+    {
+        return Reader::uring;
+    }
+    if (string == "pread")
+    {
+        return Reader::pread;
+    }
+    throw std::invalid_argument{CONCAT("Unknown reader ", std::quoted(string))};
+}
+
+std::unique_ptr<Source> open_file_source(const std::string& filename, Reader reader)
+{
+    if (reader == Reader::mmap)
+    {
+        throw std::invalid_argument{"Mapped files are not read through a source"};
+    }
+    std::unique_ptr<Source> source;
+    if (reader == Reader::uring and UringSource::is_available())
+    {
+        source = std::make_unique<UringSource>(filename);
+    }
+    else
+    {
+        source = std::make_unique<PreadSource>(filename);
+    }
+    if (const auto compression = detect_compression(filename); compression != Compression::none)
+    {
+        return std::make_unique<DecompressingSource>(std::move(source), compression);
+    }
+    return source;
+}
+} // namespace utility
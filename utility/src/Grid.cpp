@@ -0,0 +1,41 @@
+#include "utility/Grid.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Stream.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace utility
+{
+Grid<char> parse_grid(Stream& stream, char border, int padding)
+{
+    std::vector<char> cells;
+    auto width = 0;
+    auto height = 0;
+    for (const auto& line : stream)
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        if (height == 0)
+        {
+            width = static_cast<int>(line.size());
+            cells.assign(static_cast<std::size_t>(padding * (width + 2 * padding)), border);
+        }
+        else if (static_cast<int>(line.size()) != width)
+        {
+            throw std::invalid_argument{CONCAT("Row ", height, " has length ", line.size(), " instead of ", width)};
+        }
+        cells.insert(cells.end(), static_cast<std::size_t>(padding), border);
+        cells.insert(cells.end(), line.begin(), line.end());
+        cells.insert(cells.end(), static_cast<std::size_t>(padding), border);
+        ++height;
+    }
+    if (height == 0)
+    {
+        return Grid<char>{0, 0, border, padding};
+    }
+    cells.insert(cells.end(), static_cast<std::size_t>(padding * (width + 2 * padding)), border);
+    return Grid<char>{width, height, padding, std::move(cells)};
+}
+} // namespace utility
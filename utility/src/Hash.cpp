@@ -0,0 +1,79 @@
+#include "utility/Hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace utility
+{
+namespace
+{
+constexpr std::uint64_t multiplier{0x9e3779b97f4a7c15ull};
+constexpr auto word_size = sizeof(std::uint64_t);
+
+std::uint64_t mix(std::uint64_t hash, std::uint64_t word)
+{
+    return std::rotl((hash ^ word) * multiplier, 29);
+}
+
+std::uint64_t load_word(const char* data)
+{
+    std::uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+} // namespace
+
+void TextHasher::update(std::string_view text)
+{
+    size += text.size();
+    if (pending_size > 0)
+    {
+        const auto taken = std::min(block_size - pending_size, text.size());
+        std::memcpy(pending.data() + pending_size, text.data(), taken);
+        pending_size += taken;
+        text.remove_prefix(taken);
+        if (pending_size < block_size)
+        {
+            return;
+        }
+        mix_block(pending.data());
+        pending_size = 0;
+    }
+    for (; text.size() >= block_size; text.remove_prefix(block_size))
+    {
+        mix_block(text.data());
+    }
+    std::memcpy(pending.data(), text.data(), text.size());
+    pending_size = text.size();
+}
+
+std::uint64_t TextHasher::finish() const
+{
+    auto hash = mix(mix(mix(lanes[0], lanes[1]), lanes[2]), lanes[3]);
+    std::size_t offset{0};
+    for (; offset + word_size <= pending_size; offset += word_size)
+    {
+        hash = mix(hash, load_word(pending.data() + offset));
+    }
+    std::uint64_t tail{0};
+    std::memcpy(&tail, pending.data() + offset, pending_size - offset);
+    hash = mix(mix(hash, tail), size);
+    hash ^= hash >> 32;
+    return hash * multiplier;
+}
+
+void TextHasher::mix_block(const char* block)
+{
+    for (auto lane = 0u; lane < lanes.size(); ++lane)
+    {
+        lanes[lane] = mix(lanes[lane], load_word(block + lane * word_size));
+    }
+}
+
+std::uint64_t hash_text(std::string_view text)
+{
+    TextHasher hasher;
+    hasher.update(text);
+    return hasher.finish();
+}
+} // namespace utility
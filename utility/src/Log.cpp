@@ -0,0 +1,224 @@
+#include "utility/Log.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+namespace utility
+{
+namespace
+{
+constexpr std::size_t slot_count{1024};
+constexpr std::size_t max_message_size{256 - 2 * sizeof(std::size_t)};
+
+// Bounded queue of many producers and one consumer. Each slot carries a sequence number telling whether it is
+// free for the producer of a given position or filled for the consumer, so neither side takes a lock.
+class LogQueue
+{
+public:
+    LogQueue()
+    {
+        for (auto index = 0u; index < slot_count; ++index)
+        {
+            slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    // Fails when the queue is full. The message must fit into a slot.
+    bool try_push(std::string_view message)
+    {
+        auto position = head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& slot = slots[position % slot_count];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position)
+            {
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    write_message(slot, message);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < position)
+            {
+                return false;
+            }
+            else
+            {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Only called by the consumer thread.
+    bool try_pop(std::string_view& message)
+    {
+        auto& slot = slots[tail % slot_count];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1)
+        {
+            return false;
+        }
+        message = std::string_view{slot.text.data(), slot.length};
+        return true;
+    }
+
+    // Frees the slot returned by the last `try_pop`, once its message is written.
+    void release()
+    {
+        slots[tail % slot_count].sequence.store(tail + slot_count, std::memory_order_release);
+        ++tail;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        std::size_t length;
+        std::array<char, max_message_size> text;
+    };
+
+    static void write_message(Slot& slot, std::string_view message)
+    {
+        std::memcpy(slot.text.data(), message.data(), message.size());
+        slot.length = message.size();
+    }
+
+    std::array<Slot, slot_count> slots;
+    alignas(64) std::atomic<std::size_t> head{0};
+    alignas(64) std::size_t tail{0};
+};
+
+class Logger
+{
+public:
+    Logger() : writer{[this](std::stop_token stop_token) { write_messages(stop_token); }}
+    {
+    }
+
+    Logger(const Logger&) = delete;
+
+    Logger& operator=(const Logger&) = delete;
+
+    ~Logger()
+    {
+        writer.request_stop();
+        wake_writer();
+        writer.join();
+    }
+
+    // Queues the message, or drops and counts it when the queue is full.
+    void push(std::string_view message)
+    {
+        if (message.size() > max_message_size)
+        {
+            write_now(message);
+            return;
+        }
+        if (not queue.try_push(message))
+        {
+            dropped_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        pushed_count.fetch_add(1, std::memory_order_release);
+        wake_writer();
+    }
+
+    void flush()
+    {
+        const auto target = pushed_count.load(std::memory_order_acquire);
+        for (auto written = written_count.load(std::memory_order_acquire); written < target;
+            written = written_count.load(std::memory_order_acquire))
+        {
+            written_count.wait(written, std::memory_order_acquire);
+        }
+        std::cout.flush();
+    }
+
+    // Writes the message before returning, after every message queued before it.
+    void write_now(std::string_view message)
+    {
+        flush();
+        const std::lock_guard lock{output_mutex};
+        std::cout << message << '\n';
+        std::cout.flush();
+    }
+
+private:
+    void wake_writer()
+    {
+        wake_count.fetch_add(1, std::memory_order_release);
+        wake_count.notify_one();
+    }
+
+    void write_messages(std::stop_token stop_token)
+    {
+        while (true)
+        {
+            const auto wake = wake_count.load(std::memory_order_acquire);
+            const auto is_stopping = stop_token.stop_requested();
+            write_queued_messages();
+            if (is_stopping)
+            {
+                break;
+            }
+            wake_count.wait(wake, std::memory_order_acquire);
+        }
+    }
+
+    void write_queued_messages()
+    {
+        const std::lock_guard lock{output_mutex};
+        auto count = 0ull;
+        for (std::string_view message; queue.try_pop(message); queue.release())
+        {
+            std::cout << message << '\n';
+            ++count;
+        }
+        if (const auto dropped = dropped_count.exchange(0, std::memory_order_relaxed); dropped > 0)
+        {
+            std::cout << "[Log] " << dropped << " messages dropped\n";
+            count += dropped;
+        }
+        if (count > 0)
+        {
+            std::cout.flush();
+            written_count.fetch_add(count, std::memory_order_release);
+            written_count.notify_all();
+        }
+    }
+
+    LogQueue queue;
+    std::atomic<unsigned long long> pushed_count{0}, written_count{0}, dropped_count{0};
+    std::atomic<unsigned> wake_count{0};
+    std::mutex output_mutex;
+    std::jthread writer;
+};
+
+Logger& get_logger()
+{
+    static Logger logger;
+    return logger;
+}
+} // namespace
+
+void write_log(LogLevel level, std::string_view message)
+{
+    if (level >= LogLevel::warning)
+    {
+        get_logger().write_now(message);
+        return;
+    }
+    get_logger().push(message);
+}
+
+void flush_log()
+{
+    get_logger().flush();
+}
+} // namespace utility
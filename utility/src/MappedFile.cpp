@@ -0,0 +1,87 @@
+#include "utility/MappedFile.hpp"
+#include "utility/Dbg.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utility
+{
+namespace
+{
+class FileDescriptor
+{
+public:
+    FileDescriptor(int value) : value{value}
+    {
+    }
+
+    ~FileDescriptor()
+    {
+        if (value >= 0)
+        {
+            ::close(value);
+        }
+    }
+
+    int value;
+};
+} // namespace
+
+MappedFile::MappedFile(const std::string& filename) : data{nullptr}, size{0}
+{
+    const FileDescriptor fd{::open(filename.c_str(), O_RDONLY)};
+    if (fd.value < 0)
+    {
+        throw std::logic_error{CONCAT("File ", filename, " could not be open")};
+    }
+    struct stat status;
+    if (::fstat(fd.value, &status) != 0)
+    {
+        throw std::logic_error{CONCAT("File ", filename, " could not be inspected: ", std::strerror(errno))};
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    if (size == 0)
+    {
+        return;
+    }
+    auto* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.value, 0);
+    if (address == MAP_FAILED)
+    {
+        throw std::logic_error{CONCAT("File ", filename, " could not be mapped: ", std::strerror(errno))};
+    }
+    ::madvise(address, size, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(address);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)}
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+    {
+        ::munmap(const_cast<char*>(data), size);
+    }
+}
+
+std::string_view MappedFile::get_contents() const
+{
+    return std::string_view{data, size};
+}
+} // namespace utility
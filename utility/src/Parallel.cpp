@@ -0,0 +1,37 @@
+#include "utility/Parallel.hpp"
+#include "utility/ThreadPool.hpp"
+#include <algorithm>
+#include <string_view>
+
+namespace utility
+{
+namespace
+{
+constexpr auto min_chunk_size = std::size_t{256 * 1024};
+} // namespace
+
+Chunks split_into_line_chunks(std::string_view buffer, unsigned count)
+{
+    Chunks chunks;
+    const auto target_size = buffer.size() / std::max(count, 1u);
+    while (chunks.size() + 1 < count)
+    {
+        const auto newline_pos = buffer.find('\n', target_size);
+        if (newline_pos == std::string_view::npos)
+        {
+            break;
+        }
+        chunks.push_back(buffer.substr(0, newline_pos));
+        buffer.remove_prefix(newline_pos + 1);
+    }
+    chunks.push_back(buffer);
+    return chunks;
+}
+
+unsigned get_worker_count(std::string_view buffer)
+{
+    const auto thread_count = ThreadPool::get_default().get_thread_count();
+    const auto useful_count = static_cast<unsigned>(buffer.size() / min_chunk_size) + 1u;
+    return std::min(thread_count, useful_count);
+}
+} // namespace utility
@@ -0,0 +1,230 @@
+#include "utility/ParseCache.hpp"
+#include "utility/Dbg.hpp"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utility
+{
+namespace
+{
+// Raised whenever the header or the framing of the payload changes.
+constexpr std::uint32_t format_version{1};
+constexpr std::array<char, 8> magic{'A', 'O', 'C', 'P', 'A', 'R', 'S', 'E'};
+
+struct Header
+{
+    std::array<char, 8> magic;
+    std::uint32_t format_version;
+    std::uint32_t key_version;
+    std::uint64_t text_hash;
+    std::uint64_t text_size;
+    std::uint64_t payload_size;
+};
+static_assert(sizeof(Header) % alignof(std::uint64_t) == 0, "Payload must stay aligned after the header");
+
+std::atomic<bool> is_enabled{false};
+std::filesystem::path cache_directory;
+
+std::filesystem::path get_cache_path(const ParseCacheKey& key, std::uint64_t text_hash)
+{
+    std::ostringstream name;
+    name << key.name << '-' << std::hex << std::setw(16) << std::setfill('0') << text_hash << ".bin";
+    return cache_directory / name.str();
+}
+
+std::size_t get_padding(std::size_t offset, std::size_t alignment)
+{
+    return (alignment - (offset % alignment)) % alignment;
+}
+} // namespace
+
+void enable_parse_cache(const std::filesystem::path& directory)
+{
+    // Only the cache itself is private to the user, its parents are created like any other directory. An existing
+    // directory is only used when it belongs to the user and nobody else can write to it.
+    std::error_code error;
+    std::filesystem::create_directories(directory.parent_path(), error);
+    if (error or (::mkdir(directory.c_str(), 0700) != 0 and errno != EEXIST))
+    {
+        const auto message = error ? error.message() : std::strerror(errno);
+        LOG_WARNING("Parse cache ", directory.string(), " could not be created: ", message);
+        return;
+    }
+    struct stat status;
+    if (::lstat(directory.c_str(), &status) != 0
+        or not S_ISDIR(status.st_mode)
+        or status.st_uid != ::getuid()
+        or (status.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+    {
+        LOG_WARNING("Parse cache ", directory.string(), " is not a directory private to the user");
+        return;
+    }
+    cache_directory = directory;
+    is_enabled.store(true, std::memory_order_release);
+}
+
+bool is_parse_cache_enabled()
+{
+    return is_enabled.load(std::memory_order_acquire);
+}
+
+std::filesystem::path get_default_parse_cache_directory()
+{
+    // XDG_CACHE_HOME is ignored unless it is absolute, as the base directory specification demands.
+    if (const auto* cache_home = std::getenv("XDG_CACHE_HOME"); cache_home != nullptr and cache_home[0] == '/')
+    {
+        return std::filesystem::path{cache_home} / "aoc-parse-cache";
+    }
+    if (const auto* home = std::getenv("HOME"); home != nullptr and home[0] != '\0')
+    {
+        return std::filesystem::path{home} / ".cache" / "aoc-parse-cache";
+    }
+    if (const auto* user = ::getpwuid(::getuid()); user != nullptr)
+    {
+        return std::filesystem::path{user->pw_dir} / ".cache" / "aoc-parse-cache";
+    }
+    return std::filesystem::temp_directory_path() / ("aoc-parse-cache-" + std::to_string(::getuid()));
+}
+
+void ParseCacheWriter::write_string(std::string_view string)
+{
+    write_array<char>(string);
+}
+
+std::string_view ParseCacheWriter::get_payload() const
+{
+    return payload;
+}
+
+void ParseCacheWriter::write_bytes(const void* data, std::size_t size, std::size_t alignment)
+{
+    payload.append(get_padding(payload.size(), alignment), '\0');
+    payload.append(static_cast<const char*>(data), size);
+}
+
+ParseCacheReader::ParseCacheReader(std::string_view payload) : payload{payload}, offset{0}
+{
+}
+
+std::string_view ParseCacheReader::read_string()
+{
+    const auto characters = read_array<char>();
+    return std::string_view{characters.data(), characters.size()};
+}
+
+std::vector<std::string_view> ParseCacheReader::read_strings()
+{
+    const auto lengths = read_array<std::uint32_t>();
+    auto characters = read_string();
+    std::vector<std::string_view> strings;
+    strings.reserve(lengths.size());
+    for (const auto length : lengths)
+    {
+        if (length > characters.size())
+        {
+            throw std::logic_error{"Parse cache is corrupted: strings exceed their characters"};
+        }
+        strings.push_back(characters.substr(0, length));
+        characters.remove_prefix(length);
+    }
+    return strings;
+}
+
+const char* ParseCacheReader::read_bytes(std::size_t size, std::size_t alignment)
+{
+    const auto begin = offset + get_padding(offset, alignment);
+    if (begin > payload.size() or size > payload.size() - begin)
+    {
+        throw std::logic_error{"Parse cache is corrupted: read past the end of the payload"};
+    }
+    offset = begin + size;
+    return payload.data() + begin;
+}
+
+ParseCacheFile::ParseCacheFile(MappedFile file, std::string_view payload) : file{std::move(file)}, payload{payload}
+{
+}
+
+ParseCacheReader ParseCacheFile::get_reader() const
+{
+    return ParseCacheReader{payload};
+}
+
+std::optional<ParseCacheFile> open_parse_cache(const ParseCacheKey& key, std::string_view text, std::uint64_t text_hash)
+{
+    const auto path = get_cache_path(key, text_hash);
+    std::error_code error;
+    if (not std::filesystem::is_regular_file(path, error))
+    {
+        return std::nullopt;
+    }
+    MappedFile file{path.string()};
+    const auto contents = file.get_contents();
+    if (contents.size() < sizeof(Header))
+    {
+        LOG_WARNING("Ignoring truncated parse cache ", path.string());
+        return std::nullopt;
+    }
+    Header header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    const auto is_valid = header.magic == magic
+        and header.format_version == format_version
+        and header.key_version == key.version
+        and header.text_hash == text_hash
+        and header.text_size == text.size()
+        and header.payload_size == contents.size() - sizeof(Header);
+    if (not is_valid)
+    {
+        LOG_WARNING("Ignoring stale parse cache ", path.string());
+        return std::nullopt;
+    }
+    const auto payload = contents.substr(sizeof(Header));
+    return ParseCacheFile{std::move(file), payload};
+}
+
+void store_parse_cache(
+    const ParseCacheKey& key,
+    std::string_view text,
+    std::uint64_t text_hash,
+    const ParseCacheWriter& writer)
+{
+    static std::atomic<unsigned> temporary_count{0};
+    const auto path = get_cache_path(key, text_hash);
+    const auto payload = writer.get_payload();
+    const Header header{magic, format_version, key.version, text_hash, text.size(), payload.size()};
+
+    // Written aside and renamed, so that concurrent runs never map a partly written file.
+    auto temporary_path = path;
+    temporary_path += "." + std::to_string(::getpid()) + "." + std::to_string(temporary_count.fetch_add(1)) + ".tmp";
+    {
+        std::ofstream file{temporary_path, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        if (not file)
+        {
+            LOG_WARNING("Parse cache ", temporary_path.string(), " could not be written");
+            std::error_code error;
+            std::filesystem::remove(temporary_path, error);
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        LOG_WARNING("Parse cache ", path.string(), " could not be written: ", error.message());
+        std::filesystem::remove(temporary_path, error);
+    }
+}
+} // namespace utility
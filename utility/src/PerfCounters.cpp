@@ -0,0 +1,178 @@
+#include "utility/PerfCounters.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace utility
+{
+namespace
+{
+struct EventConfig
+{
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr auto l1d_read_miss_config = PERF_COUNT_HW_CACHE_L1D
+    | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+constexpr std::array<EventConfig, perf_counter_count> event_configs{{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, l1d_read_miss_config},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+}};
+
+std::atomic<bool> enabled{false};
+std::array<bool, perf_counter_count> available{};
+std::string error;
+
+int open_event(const EventConfig& config, int group_fd)
+{
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = config.type;
+    attributes.config = config.config;
+    attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    const auto this_thread = 0;
+    const auto any_cpu = -1;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, this_thread, any_cpu, group_fd, 0ul));
+}
+
+// Counters of one thread, opened as a single group so that the kernel schedules them onto the hardware together.
+class ThreadCounters
+{
+public:
+    ThreadCounters()
+    {
+        for (auto index = 0u; index < perf_counter_count; ++index)
+        {
+            const auto fd = open_event(event_configs[index], leader_fd);
+            if (fd < 0)
+            {
+                error = std::strerror(errno);
+                continue;
+            }
+            leader_fd = leader_fd < 0 ? fd : leader_fd;
+            fds.push_back(fd);
+            counters.push_back(index);
+        }
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    ~ThreadCounters()
+    {
+        for (const auto fd : fds)
+        {
+            ::close(fd);
+        }
+    }
+
+    bool is_open(std::size_t counter) const { return std::ranges::find(counters, counter) != counters.end(); }
+
+    const std::string& get_error() const { return error; }
+
+    // Values extrapolated to the whole time the group was enabled, in case the kernel multiplexed the hardware
+    // counters among more events and the group only ran for part of it.
+    PerfCounterValues read() const
+    {
+        PerfCounterValues values{};
+        if (leader_fd < 0)
+        {
+            return values;
+        }
+        // Layout of a group read: number of events, time enabled, time running and a value per event.
+        std::array<std::uint64_t, 3 + perf_counter_count> buffer{};
+        if (::read(leader_fd, buffer.data(), sizeof(buffer)) < 0 or buffer[2] == 0)
+        {
+            return values;
+        }
+        const auto count = std::min<std::size_t>(buffer[0], counters.size());
+        const auto scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+        for (auto index = 0u; index < count; ++index)
+        {
+            values[counters[index]] = static_cast<unsigned long long>(static_cast<double>(buffer[3 + index]) * scale);
+        }
+        return values;
+    }
+
+private:
+    int leader_fd{-1};
+    std::vector<int> fds;
+    std::vector<std::size_t> counters;
+    std::string error;
+};
+
+const ThreadCounters& get_thread_counters()
+{
+    thread_local const ThreadCounters counters;
+    return counters;
+}
+} // namespace
+
+std::string_view get_perf_counter_name(PerfCounter counter)
+{
+    switch (counter)
+    {
+        case PerfCounter::cycles: return "cycles";
+        case PerfCounter::instructions: return "instructions";
+        case PerfCounter::l1d_misses: return "l1d_misses";
+        case PerfCounter::llc_misses: return "llc_misses";
+        case PerfCounter::branch_misses: return "branch_misses";
+    }
+    return "unknown";
+}
+
+bool enable_perf_counters()
+{
+    if (enabled.load())
+    {
+        return true;
+    }
+    const auto& counters = get_thread_counters();
+    error = counters.get_error();
+    auto is_any_open = false;
+    for (auto index = 0u; index < perf_counter_count; ++index)
+    {
+        available[index] = counters.is_open(index);
+        is_any_open = is_any_open or available[index];
+    }
+    enabled.store(is_any_open);
+    return is_any_open;
+}
+
+bool are_perf_counters_enabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+bool is_perf_counter_available(PerfCounter counter)
+{
+    return available[static_cast<std::size_t>(counter)];
+}
+
+const std::string& get_perf_counters_error()
+{
+    return error;
+}
+
+PerfCounterValues read_perf_counters()
+{
+    return get_thread_counters().read();
+}
+} // namespace utility
@@ -0,0 +1,50 @@
+#include "utility/Registry.hpp"
+#include "utility/Dbg.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace utility
+{
+namespace
+{
+Solvers& get_mutable_solvers()
+{
+    static Solvers solvers;
+    return solvers;
+}
+
+LineTerms& get_mutable_line_terms()
+{
+    static LineTerms line_terms;
+    return line_terms;
+}
+} // namespace
+
+const Solvers& get_solvers()
+{
+    return get_mutable_solvers();
+}
+
+void register_solver(SolverId id, Solver solver)
+{
+    const auto [_, inserted] = get_mutable_solvers().emplace(id, std::move(solver));
+    if (not inserted)
+    {
+        throw std::logic_error{CONCAT("Solver of day ", id.day, " part ", id.part, " is already registered")};
+    }
+}
+
+const LineTerms& get_line_terms()
+{
+    return get_mutable_line_terms();
+}
+
+void register_line_term(SolverId id, LineTerm line_term)
+{
+    const auto [_, inserted] = get_mutable_line_terms().emplace(id, std::move(line_term));
+    if (not inserted)
+    {
+        throw std::logic_error{CONCAT("Line term of day ", id.day, " part ", id.part, " is already registered")};
+    }
+}
+} // namespace utility
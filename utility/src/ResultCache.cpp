@@ -0,0 +1,384 @@
+#include "utility/ResultCache.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Hash.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+#include <vector>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <pwd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utility
+{
+namespace
+{
+constexpr std::string_view entry_extension{".answer"};
+constexpr std::string_view key_extension{".key"};
+constexpr std::string_view size_file_name{"size"};
+
+class FileDescriptor
+{
+public:
+    FileDescriptor(int value) : value{value}
+    {
+    }
+
+    ~FileDescriptor()
+    {
+        if (value >= 0)
+        {
+            ::close(value);
+        }
+    }
+
+    int value;
+};
+
+std::atomic<bool> is_enabled{false};
+std::filesystem::path cache_directory;
+std::uintmax_t cache_size_limit{default_result_cache_size_limit};
+
+std::string to_hex(const unsigned char* data, std::size_t size)
+{
+    std::ostringstream hex;
+    hex << std::hex << std::setfill('0');
+    for (auto index = 0u; index < size; ++index)
+    {
+        hex << std::setw(2) << static_cast<unsigned>(data[index]);
+    }
+    return hex.str();
+}
+
+std::string to_hex(std::uint64_t value)
+{
+    std::ostringstream hex;
+    hex << std::hex << std::setw(16) << std::setfill('0') << value;
+    return hex.str();
+}
+
+// Looks for the NT_GNU_BUILD_ID note among the program headers of the executable, which is the first object.
+int find_build_id_note(dl_phdr_info* info, std::size_t, void* data)
+{
+    auto& build_id = *static_cast<std::string*>(data);
+    for (auto index = 0u; index < info->dlpi_phnum; ++index)
+    {
+        const auto& header = info->dlpi_phdr[index];
+        if (header.p_type != PT_NOTE)
+        {
+            continue;
+        }
+        const auto* note = reinterpret_cast<const unsigned char*>(info->dlpi_addr + header.p_vaddr);
+        const auto* notes_end = note + header.p_memsz;
+        const auto align = [](std::size_t size) { return (size + 3) & ~std::size_t{3}; };
+        while (note + sizeof(ElfW(Nhdr)) <= notes_end)
+        {
+            const auto* note_header = reinterpret_cast<const ElfW(Nhdr)*>(note);
+            const auto* name = note + sizeof(ElfW(Nhdr));
+            const auto* description = name + align(note_header->n_namesz);
+            if (note_header->n_type == NT_GNU_BUILD_ID
+                and note_header->n_namesz == 4
+                and std::string_view{reinterpret_cast<const char*>(name), 4} == std::string_view{"GNU", 4})
+            {
+                build_id = to_hex(description, note_header->n_descsz);
+                return 1;
+            }
+            note = description + align(note_header->n_descsz);
+        }
+    }
+    return 1;
+}
+
+std::string read_build_id()
+{
+    std::string build_id;
+    ::dl_iterate_phdr(find_build_id_note, &build_id);
+    if (not build_id.empty())
+    {
+        return build_id;
+    }
+    struct stat status;
+    if (::stat("/proc/self/exe", &status) != 0)
+    {
+        return "unknown";
+    }
+    const auto modification_time = static_cast<std::uint64_t>(status.st_mtim.tv_sec) * 1'000'000'000ull
+        + static_cast<std::uint64_t>(status.st_mtim.tv_nsec);
+    return to_hex(static_cast<std::uint64_t>(status.st_size)) + to_hex(modification_time);
+}
+
+std::filesystem::path get_entry_path(const ResultCacheKey& key)
+{
+    const auto build_id = get_build_id().substr(0, 16);
+    const auto name = std::string{key.solver} + "-" + to_hex(key.input_hash) + "-" + std::string{build_id};
+    return cache_directory / (name + std::string{entry_extension});
+}
+
+std::string format_stamp(const FileStamp& stamp)
+{
+    std::ostringstream text;
+    text << "file " << stamp.device << ' ' << stamp.inode << ' ' << stamp.size << ' ' << stamp.modification_time << ' '
+         << stamp.change_time << '\n';
+    return text.str();
+}
+
+// Keys of files do not depend on the solver or the build, so all solvers share the one of a file.
+std::filesystem::path get_key_path(const FileStamp& stamp)
+{
+    return cache_directory / ("file-" + to_hex(hash_text(format_stamp(stamp))) + std::string{key_extension});
+}
+
+// Whole key written at the start of an entry, so that an entry is only used for exactly the same key.
+std::string format_key(const ResultCacheKey& key)
+{
+    std::ostringstream text;
+    text << "solver " << key.solver << '\n'
+         << "build " << get_build_id() << '\n'
+         << "input " << to_hex(key.input_hash) << ' ' << key.input_size << '\n';
+    return text.str();
+}
+
+// Removes the least recently used entries until the cache fits into its size limit, and returns the size left.
+std::uintmax_t trim_result_cache()
+{
+    struct Entry
+    {
+        std::filesystem::file_time_type time;
+        std::uintmax_t size;
+        std::filesystem::path path;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t total_size{0};
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator{cache_directory, error})
+    {
+        const auto extension = file.path().extension();
+        if ((extension != entry_extension and extension != key_extension) or not file.is_regular_file(error))
+        {
+            continue;
+        }
+        const auto size = file.file_size(error);
+        const auto time = file.last_write_time(error);
+        if (error)
+        {
+            continue;
+        }
+        entries.push_back(Entry{time, size, file.path()});
+        total_size += size;
+    }
+    std::ranges::sort(entries, {}, &Entry::time);
+    for (const auto& entry : entries)
+    {
+        if (total_size <= cache_size_limit)
+        {
+            break;
+        }
+        if (std::filesystem::remove(entry.path, error))
+        {
+            total_size -= entry.size;
+        }
+    }
+    return total_size;
+}
+
+// Adds the change to the total size of the entries, which is kept in a file next to them so that storing an entry
+// does not have to scan the directory. Runs sharing the cache update it under an exclusive lock, and the directory is
+// only scanned to trim it once the total exceeds the limit. A missing or stale total is corrected by the next trim.
+void update_cache_size(std::intmax_t change)
+{
+    const auto path = cache_directory / size_file_name;
+    const FileDescriptor fd{::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600)};
+    if (fd.value < 0 or ::flock(fd.value, LOCK_EX) != 0)
+    {
+        LOG_WARNING("Result cache size ", path.string(), " could not be locked: ", std::strerror(errno));
+        return;
+    }
+    std::array<char, 32> text{};
+    const auto length = ::pread(fd.value, text.data(), text.size(), 0);
+    std::uintmax_t total_size{0};
+    std::from_chars(text.data(), text.data() + std::max(length, ssize_t{0}), total_size);
+    total_size = change < 0 and static_cast<std::uintmax_t>(-change) > total_size
+        ? 0
+        : total_size + static_cast<std::uintmax_t>(change);
+    if (total_size > cache_size_limit)
+    {
+        total_size = trim_result_cache();
+    }
+    const auto [end, _] = std::to_chars(text.data(), text.data() + text.size(), total_size);
+    const auto new_length = static_cast<std::size_t>(end - text.data());
+    if (::ftruncate(fd.value, 0) != 0
+        or ::pwrite(fd.value, text.data(), new_length, 0) != static_cast<ssize_t>(new_length))
+    {
+        LOG_WARNING("Result cache size ", path.string(), " could not be written: ", std::strerror(errno));
+    }
+}
+
+// Reads the file and marks it as recently used, when it starts with the prefix and ends with a newline. The rest of
+// the file up to the newline is returned.
+std::optional<std::string> read_entry(const std::filesystem::path& path, std::string_view prefix)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (not file)
+    {
+        return std::nullopt;
+    }
+    const std::string contents{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    if (not contents.starts_with(prefix) or not contents.ends_with('\n'))
+    {
+        LOG_WARNING("Ignoring stale result cache ", path.string());
+        return std::nullopt;
+    }
+    std::error_code error;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+    return contents.substr(prefix.size(), contents.size() - prefix.size() - 1);
+}
+
+void write_entry(const std::filesystem::path& path, std::string_view contents)
+{
+    // Written aside and renamed, so that concurrent runs and solves never read a partly written entry.
+    static std::atomic<unsigned> temporary_count{0};
+    auto temporary_path = path;
+    temporary_path += "." + std::to_string(::getpid()) + "." + std::to_string(temporary_count.fetch_add(1)) + ".tmp";
+    {
+        std::ofstream file{temporary_path, std::ios::binary};
+        file << contents;
+        if (not file)
+        {
+            LOG_WARNING("Result cache ", temporary_path.string(), " could not be written");
+            std::error_code error;
+            std::filesystem::remove(temporary_path, error);
+            return;
+        }
+    }
+    std::error_code error;
+    const auto new_size = std::filesystem::file_size(temporary_path, error);
+    const auto replaced_size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        LOG_WARNING("Result cache ", path.string(), " could not be written: ", error.message());
+        std::filesystem::remove(temporary_path, error);
+        return;
+    }
+    update_cache_size(static_cast<std::intmax_t>(new_size) - static_cast<std::intmax_t>(replaced_size));
+}
+} // namespace
+
+void enable_result_cache(const std::filesystem::path& directory, std::uintmax_t size_limit)
+{
+    // Only the cache itself is private to the user, its parents are created like any other directory.
+    std::error_code error;
+    std::filesystem::create_directories(directory.parent_path(), error);
+    if (error or (::mkdir(directory.c_str(), 0700) != 0 and errno != EEXIST))
+    {
+        const auto message = error ? error.message() : std::strerror(errno);
+        LOG_WARNING("Result cache ", directory.string(), " could not be created: ", message);
+        return;
+    }
+    cache_directory = directory;
+    cache_size_limit = size_limit;
+    is_enabled.store(true, std::memory_order_release);
+}
+
+bool is_result_cache_enabled()
+{
+    return is_enabled.load(std::memory_order_acquire);
+}
+
+std::filesystem::path get_default_result_cache_directory()
+{
+    // XDG_CACHE_HOME is ignored unless it is absolute, as the base directory specification demands.
+    if (const auto* cache_home = std::getenv("XDG_CACHE_HOME"); cache_home != nullptr and cache_home[0] == '/')
+    {
+        return std::filesystem::path{cache_home} / "aoc-result-cache";
+    }
+    if (const auto* home = std::getenv("HOME"); home != nullptr and home[0] != '\0')
+    {
+        return std::filesystem::path{home} / ".cache" / "aoc-result-cache";
+    }
+    if (const auto* user = ::getpwuid(::getuid()); user != nullptr)
+    {
+        return std::filesystem::path{user->pw_dir} / ".cache" / "aoc-result-cache";
+    }
+    return std::filesystem::temp_directory_path() / ("aoc-result-cache-" + std::to_string(::getuid()));
+}
+
+std::string_view get_build_id()
+{
+    static const auto build_id = read_build_id();
+    return build_id;
+}
+
+ResultCacheKey make_result_cache_key(std::string_view solver, const TextHasher& input_hasher)
+{
+    return ResultCacheKey{solver, input_hasher.finish(), input_hasher.get_size()};
+}
+
+std::optional<std::string> find_cached_result(const ResultCacheKey& key)
+{
+    return read_entry(get_entry_path(key), format_key(key) + "answer ");
+}
+
+void store_cached_result(const ResultCacheKey& key, std::string_view answer)
+{
+    write_entry(get_entry_path(key), format_key(key) + "answer " + std::string{answer} + "\n");
+}
+
+std::optional<FileStamp> read_file_stamp(const std::string& filename)
+{
+    struct stat status;
+    if (::stat(filename.c_str(), &status) != 0)
+    {
+        return std::nullopt;
+    }
+    const auto to_nanoseconds = [](const timespec& time) {
+        return static_cast<std::uint64_t>(time.tv_sec) * 1'000'000'000ull + static_cast<std::uint64_t>(time.tv_nsec);
+    };
+    return FileStamp{
+        static_cast<std::uint64_t>(status.st_dev),
+        static_cast<std::uint64_t>(status.st_ino),
+        static_cast<std::uint64_t>(status.st_size),
+        to_nanoseconds(status.st_mtim),
+        to_nanoseconds(status.st_ctim)};
+}
+
+std::optional<ResultCacheKey> find_cached_key(std::string_view solver, const FileStamp& stamp)
+{
+    const auto path = get_key_path(stamp);
+    const auto input = read_entry(path, format_stamp(stamp) + "input ");
+    if (not input.has_value())
+    {
+        return std::nullopt;
+    }
+    ResultCacheKey key{solver, 0, 0};
+    const auto* end = input->data() + input->size();
+    const auto [hash_end, hash_error] = std::from_chars(input->data(), end, key.input_hash, 16);
+    if (hash_error != std::errc{} or hash_end == end or *hash_end != ' '
+        or std::from_chars(hash_end + 1, end, key.input_size).ptr != end)
+    {
+        LOG_WARNING("Ignoring corrupted result cache ", path.string());
+        return std::nullopt;
+    }
+    return key;
+}
+
+void store_cached_key(const ResultCacheKey& key, const FileStamp& stamp)
+{
+    std::ostringstream input;
+    input << format_stamp(stamp) << "input " << to_hex(key.input_hash) << ' ' << key.input_size << '\n';
+    write_entry(get_key_path(stamp), input.str());
+}
+} // namespace utility
@@ -0,0 +1,12 @@
+#include "utility/Scanner.hpp"
+#include "utility/Dbg.hpp"
+#include <stdexcept>
+#include <string_view>
+
+namespace utility::scanner
+{
+void throw_mismatch(std::string_view line, std::string_view format)
+{
+    throw std::invalid_argument{CONCAT("Line ", std::quoted(line), " does not match format ", std::quoted(format))};
+}
+} // namespace utility::scanner
@@ -0,0 +1,47 @@
+#include "utility/Source.hpp"
+#include <istream>
+#include <string_view>
+#include <utility>
+
+namespace utility
+{
+namespace
+{
+constexpr auto istream_chunk_size = std::size_t{64 * 1024};
+} // namespace
+
+IstreamSource::IstreamSource(std::istream& stream) : stream{stream}, buffer(istream_chunk_size)
+{
+}
+
+std::string_view IstreamSource::read()
+{
+    stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const auto count = static_cast<std::size_t>(stream.gcount());
+    return std::string_view{buffer.data(), count};
+}
+
+HashingSource::HashingSource(std::unique_ptr<Source> source, TextHasher& hasher)
+    : source{std::move(source)}, hasher{hasher}, is_exhausted{false}
+{
+}
+
+std::string_view HashingSource::read()
+{
+    if (is_exhausted)
+    {
+        return {};
+    }
+    const auto chunk = source->read();
+    hasher.update(chunk);
+    is_exhausted = chunk.empty();
+    return chunk;
+}
+
+void HashingSource::drain()
+{
+    while (not read().empty())
+    {
+    }
+}
+} // namespace utility
@@ -1,21 +1,25 @@
 #include "utility/Stream.hpp"
-#include <fstream>
-#include <string>
-#include <iterator>
+#include "utility/Source.hpp"
 #include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 
 namespace utility
 {
-StreamIterator::StreamIterator(std::istream& s) : stream{&s}
+StreamIterator::StreamIterator(Stream& s) : stream{&s}, is_end_of_stream{false}
 {
     read();
 }
 
 StreamIterator::StreamIterator() : stream{nullptr}, is_end_of_stream{true} {}
 
-const StreamIterator::value_type& StreamIterator::operator*() const { return current_line; }
+const StreamIterator::value_type& StreamIterator::operator*() const { return stream->current_line; }
 
-const StreamIterator::value_type* StreamIterator::operator->() const { return &current_line; }
+const StreamIterator::value_type* StreamIterator::operator->() const { return &stream->current_line; }
 
 StreamIterator& StreamIterator::operator++()
 {
@@ -23,7 +27,7 @@ StreamIterator& StreamIterator::operator++()
     return *this;
 }
 
-StreamIterator StreamIterator::operator++(int) { return StreamIterator{*stream}; }
+void StreamIterator::operator++(int) { read(); }
 
 bool operator==(const StreamSentinel&, const StreamIterator& itr)
 {
@@ -37,32 +41,134 @@ bool operator!=(const StreamSentinel& sen, const StreamIterator& itr)
 
 void StreamIterator::read()
 {
-    is_end_of_stream = stream->eof();
-    if (not is_end_of_stream)
-    {
-        std::getline(*stream, current_line);
-    }
+    is_end_of_stream = not stream->read();
 }
 
 
-Stream::Stream(std::istream& stream) : stream{stream}
+Stream::Stream(std::istream& stream)
+    : owned_source{std::make_unique<IstreamSource>(stream)}, source{owned_source.get()}, is_last_line_read{false}
 {
 }
 
-bool Stream::is_active() const { return not stream.eof(); }
+Stream::Stream(std::string_view buffer) : source{nullptr}, chunk{buffer}, is_last_line_read{false}
+{
+}
 
-std::string Stream::next_line() { return *StreamIterator{stream}; }
+Stream::Stream(Source& source) : source{&source}, is_last_line_read{false}
+{
+}
+
+Stream::Stream(std::unique_ptr<Source> source)
+    : owned_source{std::move(source)}, source{owned_source.get()}, is_last_line_read{false}
+{
+}
+
+bool Stream::is_active() const { return not is_last_line_read; }
+
+std::string_view Stream::next_line()
+{
+    read();
+    return current_line;
+}
 
 void Stream::skip(unsigned count)
 {
     for (auto i = 0u; i < count; ++i)
     {
-        StreamIterator{stream};
+        read();
     }
 }
 
-StreamIterator Stream::begin() { return StreamIterator{stream}; }
+StreamIterator Stream::begin() { return StreamIterator{*this}; }
 
 StreamSentinel Stream::end() { return StreamSentinel{}; }
-} // namespace utility
 
+std::optional<std::string_view> Stream::take_buffer()
+{
+    if (source != nullptr or is_last_line_read)
+    {
+        return std::nullopt;
+    }
+    is_last_line_read = true;
+    return std::exchange(chunk, std::string_view{});
+}
+
+namespace
+{
+// Lines of files written on Windows end with a carriage return before the newline.
+std::string_view strip_carriage_return(std::string_view line)
+{
+    if (line.ends_with('\r'))
+    {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+} // namespace
+
+bool Stream::read()
+{
+    if (is_last_line_read)
+    {
+        current_line = std::string_view{};
+        return false;
+    }
+    auto is_carried = false;
+    while (true)
+    {
+        if (chunk.empty() and source != nullptr)
+        {
+            chunk = source->read();
+            if (chunk.empty())
+            {
+                source = nullptr;
+            }
+        }
+        const auto newline_pos = chunk.find('\n');
+        if (newline_pos != std::string_view::npos)
+        {
+            const auto line = chunk.substr(0, newline_pos);
+            chunk.remove_prefix(newline_pos + 1);
+            if (is_carried)
+            {
+                carry.append(line);
+                current_line = strip_carriage_return(carry);
+            }
+            else
+            {
+                current_line = strip_carriage_return(line);
+            }
+            // A newline which ends the input does not start another, empty line.
+            is_last_line_read = chunk.empty() and source == nullptr;
+            return true;
+        }
+        if (source == nullptr)
+        {
+            is_last_line_read = true;
+            if (not is_carried and chunk.empty())
+            {
+                current_line = std::string_view{};
+                return false;
+            }
+            if (is_carried)
+            {
+                carry.append(chunk);
+                current_line = strip_carriage_return(carry);
+            }
+            else
+            {
+                current_line = strip_carriage_return(chunk);
+            }
+            chunk = std::string_view{};
+            return true;
+        }
+        if (not is_carried)
+        {
+            carry.clear();
+            is_carried = true;
+        }
+        carry.append(chunk);
+        chunk = std::string_view{};
+    }
+}
+} // namespace utility
@@ -0,0 +1,216 @@
+#include "utility/ThreadPool.hpp"
+#include "utility/Timer.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace utility
+{
+namespace
+{
+// Pool and queue of the worker running on the calling thread.
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+std::atomic<unsigned> default_thread_count{0};
+
+unsigned get_configured_thread_count()
+{
+    if (const auto count = default_thread_count.load(); count > 0)
+    {
+        return count;
+    }
+    if (const auto* variable = std::getenv("AOC_THREADS"); variable != nullptr)
+    {
+        const auto count = std::stoul(variable);
+        if (count == 0)
+        {
+            throw std::invalid_argument{"AOC_THREADS must be positive"};
+        }
+        return static_cast<unsigned>(count);
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+} // namespace
+
+ThreadPool::ThreadPool(unsigned thread_count)
+{
+    const auto worker_count = std::max(thread_count, 1u) - 1;
+    for (auto index = 0u; index < worker_count; ++index)
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (auto index = 0u; index < worker_count; ++index)
+    {
+        workers.emplace_back([this, index](std::stop_token stop_token) { work(stop_token, index); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    for (auto& worker : workers)
+    {
+        worker.request_stop();
+    }
+    wake_condition.notify_all();
+}
+
+void ThreadPool::submit(Task task)
+{
+    if (queues.empty())
+    {
+        task();
+        return;
+    }
+    if (ScopedTimer::is_enabled())
+    {
+        task = [context = get_phase_context(), task = std::move(task)]() {
+            const ScopedPhaseContext phase_context{context};
+            task();
+        };
+    }
+    const auto index = current_pool == this
+        ? current_queue
+        : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    // Counted before it is published, so that a worker stealing it at once never takes the count below zero.
+    {
+        const std::scoped_lock lock{wake_mutex};
+        ++queued_count;
+    }
+    {
+        const std::scoped_lock lock{queues[index]->mutex};
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    wake_condition.notify_one();
+}
+
+bool ThreadPool::run_pending_task()
+{
+    const auto first_index = current_pool == this ? current_queue : 0;
+    auto task = take_task(first_index);
+    if (not task.has_value())
+    {
+        return false;
+    }
+    (*task)();
+    return true;
+}
+
+std::optional<ThreadPool::Task> ThreadPool::take_task(std::size_t first_index)
+{
+    for (auto offset = 0u; offset < queues.size(); ++offset)
+    {
+        const auto index = (first_index + offset) % queues.size();
+        auto& queue = *queues[index];
+        std::unique_lock lock{queue.mutex};
+        if (queue.tasks.empty())
+        {
+            continue;
+        }
+        const auto is_own_queue = current_pool == this and index == current_queue;
+        auto task = is_own_queue ? std::move(queue.tasks.back()) : std::move(queue.tasks.front());
+        if (is_own_queue)
+        {
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            queue.tasks.pop_front();
+        }
+        lock.unlock();
+        const std::scoped_lock wake_lock{wake_mutex};
+        --queued_count;
+        return task;
+    }
+    return std::nullopt;
+}
+
+void ThreadPool::work(std::stop_token stop_token, std::size_t index)
+{
+    current_pool = this;
+    current_queue = index;
+    while (not stop_token.stop_requested())
+    {
+        if (run_pending_task())
+        {
+            continue;
+        }
+        std::unique_lock lock{wake_mutex};
+        wake_condition.wait(lock, stop_token, [this] { return queued_count > 0; });
+    }
+}
+
+ThreadPool& ThreadPool::get_default()
+{
+    static ThreadPool pool{get_configured_thread_count()};
+    return pool;
+}
+
+void ThreadPool::set_default_thread_count(unsigned count)
+{
+    default_thread_count.store(std::max(count, 1u));
+}
+
+void TaskGroup::wait()
+{
+    wait_for_tasks();
+    const std::scoped_lock lock{mutex};
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+}
+
+void TaskGroup::start_task()
+{
+    const std::scoped_lock lock{mutex};
+    ++pending_count;
+}
+
+// The group may be destroyed as soon as the waiter sees no pending task, so the mutex is held until the end.
+void TaskGroup::finish_task(std::exception_ptr task_exception)
+{
+    const std::scoped_lock lock{mutex};
+    if (task_exception != nullptr and exception == nullptr)
+    {
+        exception = std::move(task_exception);
+    }
+    if (--pending_count == 0)
+    {
+        condition.notify_all();
+    }
+}
+
+// Helps the pool while there are queued tasks and sleeps once the remaining ones of the group are all running.
+void TaskGroup::wait_for_tasks()
+{
+    while (true)
+    {
+        {
+            const std::scoped_lock lock{mutex};
+            if (pending_count == 0)
+            {
+                return;
+            }
+        }
+        if (not pool.run_pending_task())
+        {
+            std::unique_lock lock{mutex};
+            condition.wait(lock, [this] { return pending_count == 0; });
+            return;
+        }
+    }
+}
+
+std::size_t get_default_chunk_size(std::size_t count, const ThreadPool& pool)
+{
+    constexpr auto chunks_per_thread = 4u;
+    return std::max<std::size_t>(1, count / (chunks_per_thread * pool.get_thread_count()));
+}
+} // namespace utility
@@ -0,0 +1,235 @@
+#include "utility/Timer.hpp"
+#include "utility/Dbg.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <time.h>
+
+namespace utility
+{
+namespace
+{
+std::chrono::nanoseconds get_cpu_time()
+{
+    timespec time;
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+std::mutex phases_mutex;
+std::vector<PhaseTiming> phases;
+
+// Names of the timers currently running on this thread, joined with '/'.
+thread_local std::string current_path;
+thread_local unsigned current_depth = 0;
+
+std::size_t find_or_add_phase(const std::string& name, unsigned depth)
+{
+    const std::scoped_lock lock{phases_mutex};
+    const auto phase_itr = std::ranges::find(phases, name, &PhaseTiming::name);
+    if (phase_itr != phases.end())
+    {
+        return static_cast<std::size_t>(phase_itr - phases.begin());
+    }
+    phases.push_back(PhaseTiming{name, depth, 0, {}, {}, {}, {}});
+    return phases.size() - 1;
+}
+
+void add_to_phase(
+    std::size_t index,
+    std::chrono::nanoseconds wall_time,
+    std::chrono::nanoseconds cpu_time,
+    const PhaseAllocations& allocations,
+    const PerfCounterValues& counters)
+{
+    const std::scoped_lock lock{phases_mutex};
+    auto& phase = phases[index];
+    phase.calls += 1;
+    phase.wall_time += wall_time;
+    phase.cpu_time += cpu_time;
+    phase.allocations.allocations += allocations.allocations;
+    phase.allocations.allocated_bytes += allocations.allocated_bytes;
+    phase.allocations.peak_bytes = std::max(phase.allocations.peak_bytes, allocations.peak_bytes);
+    for (auto counter = 0u; counter < perf_counter_count; ++counter)
+    {
+        phase.counters[counter] += counters[counter];
+    }
+}
+
+double to_milliseconds(std::chrono::nanoseconds time)
+{
+    return std::chrono::duration<double, std::milli>{time}.count();
+}
+
+double to_kilobytes(long long bytes)
+{
+    return static_cast<double>(bytes) / 1024.0;
+}
+
+void print_text(std::ostream& stream, const std::vector<PhaseTiming>& timings)
+{
+    stream << std::fixed << std::setprecision(3);
+    for (const auto& phase : timings)
+    {
+        const auto name = std::string_view{phase.name}.substr(phase.name.find_last_of('/') + 1);
+        stream << std::string(2 * phase.depth, ' ') << name
+            << ": wall " << to_milliseconds(phase.wall_time) << " ms"
+            << ", cpu " << to_milliseconds(phase.cpu_time) << " ms"
+            << ", calls " << phase.calls;
+        if (is_allocation_tracking_enabled())
+        {
+            stream << ", allocations " << phase.allocations.allocations
+                << ", allocated " << to_kilobytes(static_cast<long long>(phase.allocations.allocated_bytes)) << " kB"
+                << ", peak " << to_kilobytes(phase.allocations.peak_bytes) << " kB";
+        }
+        for (auto counter = 0u; counter < perf_counter_count; ++counter)
+        {
+            if (is_perf_counter_available(PerfCounter(counter)))
+            {
+                stream << ", " << get_perf_counter_name(PerfCounter(counter)) << ' ' << phase.counters[counter];
+            }
+        }
+        stream << '\n';
+    }
+    stream << std::defaultfloat;
+}
+
+void print_json(std::ostream& stream, const std::vector<PhaseTiming>& timings)
+{
+    stream << "{\"phases\":[";
+    for (auto phase_itr = timings.begin(); phase_itr != timings.end(); ++phase_itr)
+    {
+        if (phase_itr != timings.begin())
+        {
+            stream << ',';
+        }
+        stream << "{\"name\":" << std::quoted(phase_itr->name)
+            << ",\"depth\":" << phase_itr->depth
+            << ",\"calls\":" << phase_itr->calls
+            << ",\"wall_ns\":" << phase_itr->wall_time.count()
+            << ",\"cpu_ns\":" << phase_itr->cpu_time.count();
+        if (is_allocation_tracking_enabled())
+        {
+            stream << ",\"allocations\":" << phase_itr->allocations.allocations
+                << ",\"allocated_bytes\":" << phase_itr->allocations.allocated_bytes
+                << ",\"peak_bytes\":" << phase_itr->allocations.peak_bytes;
+        }
+        for (auto counter = 0u; counter < perf_counter_count; ++counter)
+        {
+            if (is_perf_counter_available(PerfCounter(counter)))
+            {
+                stream << ",\"" << get_perf_counter_name(PerfCounter(counter)) << "\":" << phase_itr->counters[counter];
+            }
+        }
+        stream << '}';
+    }
+    stream << "]}\n";
+}
+} // namespace
+
+PhaseContext get_phase_context()
+{
+    return PhaseContext{current_path, current_depth};
+}
+
+ScopedPhaseContext::ScopedPhaseContext(PhaseContext context)
+    : previous{std::exchange(current_path, std::move(context.path)), std::exchange(current_depth, context.depth)}
+{
+}
+
+ScopedPhaseContext::~ScopedPhaseContext()
+{
+    current_path = std::move(previous.path);
+    current_depth = previous.depth;
+}
+
+void ScopedTimer::start()
+{
+    parent_path_length = current_path.size();
+    if (not current_path.empty())
+    {
+        current_path += '/';
+    }
+    current_path.append(phase);
+    phase_index = find_or_add_phase(current_path, current_depth);
+    ++current_depth;
+    is_started = true;
+    if (is_allocation_tracking_enabled())
+    {
+        allocation_start = get_allocation_counters();
+        previous_peak = begin_peak_measurement();
+    }
+    if (are_perf_counters_enabled())
+    {
+        counters_start = read_perf_counters();
+    }
+    cpu_start = get_cpu_time();
+    wall_start = std::chrono::steady_clock::now();
+}
+
+void ScopedTimer::stop()
+{
+    const auto wall_time = std::chrono::steady_clock::now() - wall_start;
+    const auto cpu_time = get_cpu_time() - cpu_start;
+    PerfCounterValues counters{};
+    if (are_perf_counters_enabled())
+    {
+        counters = read_perf_counters();
+        for (auto counter = 0u; counter < perf_counter_count; ++counter)
+        {
+            counters[counter] -= counters_start[counter];
+        }
+    }
+    PhaseAllocations allocations;
+    if (is_allocation_tracking_enabled())
+    {
+        const auto allocation_end = get_allocation_counters();
+        allocations.allocations = allocation_end.allocations - allocation_start.allocations;
+        allocations.allocated_bytes = allocation_end.allocated_bytes - allocation_start.allocated_bytes;
+        allocations.peak_bytes = end_peak_measurement(previous_peak) - allocation_start.live_bytes;
+    }
+    add_to_phase(phase_index, wall_time, cpu_time, allocations, counters);
+    --current_depth;
+    current_path.resize(parent_path_length);
+}
+
+std::vector<PhaseTiming> get_phase_timings()
+{
+    const std::scoped_lock lock{phases_mutex};
+    return phases;
+}
+
+TimingFormat parse_timing_format(std::string_view string)
+{
+    if (string.empty() or string == "text")
+    {
+        return TimingFormat::text;
+    }
+    if (string == "json")
+    {
+        return TimingFormat::json;
+    }
+    throw std::invalid_argument{CONCAT("Unknown timing format ", std::quoted(string))};
+}
+
+void print_timings(std::ostream& stream, TimingFormat format)
+{
+    const auto timings = get_phase_timings();
+    if (format == TimingFormat::json)
+    {
+        print_json(stream, timings);
+    }
+    else
+    {
+        print_text(stream, timings);
+    }
+}
+} // namespace utility
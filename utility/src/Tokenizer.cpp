@@ -0,0 +1,93 @@
+#include "utility/Tokenizer.hpp"
+#include "utility/CpuFeatures.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define AOC_HAS_X86_KERNELS
+#endif
+
+namespace utility
+{
+namespace
+{
+bool is_integer_start(char c, bool is_signed)
+{
+    return (c >= '0' and c <= '9') or (is_signed and c == '-');
+}
+
+const char* find_integer_start_scalar(const char* first, const char* last, bool is_signed)
+{
+    while (first != last and not is_integer_start(*first, is_signed))
+    {
+        ++first;
+    }
+    return first;
+}
+
+#ifdef AOC_HAS_X86_KERNELS
+__attribute__((target("avx2")))
+const char* find_integer_start_avx2(const char* first, const char* last, bool is_signed)
+{
+    constexpr auto width = 32;
+    const auto zeros = _mm256_set1_epi8('0');
+    const auto nines = _mm256_set1_epi8(9);
+    const auto minuses = _mm256_set1_epi8(is_signed ? '-' : '0');
+    while (last - first >= width)
+    {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const auto offsets = _mm256_sub_epi8(chunk, zeros);
+        const auto are_digits = _mm256_cmpeq_epi8(_mm256_min_epu8(offsets, nines), offsets);
+        const auto are_minuses = _mm256_cmpeq_epi8(chunk, minuses);
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(are_digits, are_minuses)));
+        if (mask != 0)
+        {
+            return first + __builtin_ctz(mask);
+        }
+        first += width;
+    }
+    return find_integer_start_scalar(first, last, is_signed);
+}
+
+__attribute__((target("sse2")))
+const char* find_integer_start_sse2(const char* first, const char* last, bool is_signed)
+{
+    constexpr auto width = 16;
+    const auto zeros = _mm_set1_epi8('0');
+    const auto nines = _mm_set1_epi8(9);
+    const auto minuses = _mm_set1_epi8(is_signed ? '-' : '0');
+    while (last - first >= width)
+    {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const auto offsets = _mm_sub_epi8(chunk, zeros);
+        const auto are_digits = _mm_cmpeq_epi8(_mm_min_epu8(offsets, nines), offsets);
+        const auto are_minuses = _mm_cmpeq_epi8(chunk, minuses);
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(are_digits, are_minuses)));
+        if (mask != 0)
+        {
+            return first + __builtin_ctz(mask);
+        }
+        first += width;
+    }
+    return find_integer_start_scalar(first, last, is_signed);
+}
+#else
+const char* find_integer_start_avx2(const char* first, const char* last, bool is_signed)
+{
+    return find_integer_start_scalar(first, last, is_signed);
+}
+
+const char* find_integer_start_sse2(const char* first, const char* last, bool is_signed)
+{
+    return find_integer_start_scalar(first, last, is_signed);
+}
+#endif
+} // namespace
+
+const char* find_integer_start(const char* first, const char* last, bool is_signed)
+{
+    static const auto kernel = select_kernel(
+        find_integer_start_scalar,
+        find_integer_start_sse2,
+        find_integer_start_avx2);
+    return kernel(first, last, is_signed);
+}
+} // namespace utility
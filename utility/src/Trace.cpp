@@ -0,0 +1,105 @@
+#include "utility/Trace.hpp"
+#include "utility/Dbg.hpp"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utility
+{
+namespace
+{
+struct TraceEvent
+{
+    std::string_view name;
+    TraceClock::time_point begin, end;
+};
+
+struct ThreadBuffer
+{
+    unsigned thread_id;
+    std::vector<TraceEvent> events;
+};
+
+std::atomic<bool> enabled{false};
+const auto trace_start = TraceClock::now();
+
+// Buffers are owned here rather than by their threads, so that the spans of finished threads are kept.
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+ThreadBuffer& register_thread_buffer()
+{
+    constexpr auto initial_capacity = 4096u;
+    const std::scoped_lock lock{buffers_mutex};
+    auto& buffer = buffers.emplace_back(std::make_unique<ThreadBuffer>());
+    buffer->thread_id = static_cast<unsigned>(buffers.size());
+    buffer->events.reserve(initial_capacity);
+    return *buffer;
+}
+
+ThreadBuffer& get_thread_buffer()
+{
+    thread_local auto& buffer = register_thread_buffer();
+    return buffer;
+}
+
+double to_microseconds(TraceClock::duration time)
+{
+    return std::chrono::duration<double, std::micro>{time}.count();
+}
+} // namespace
+
+bool is_tracing_enabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void set_tracing_enabled(bool value)
+{
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+void record_trace_event(std::string_view name, TraceClock::time_point begin, TraceClock::time_point end)
+{
+    get_thread_buffer().events.push_back(TraceEvent{name, begin, end});
+}
+
+void write_trace(std::ostream& stream)
+{
+    const std::scoped_lock lock{buffers_mutex};
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    auto is_first = true;
+    stream << std::fixed << std::setprecision(3);
+    for (const auto& buffer : buffers)
+    {
+        for (const auto& [name, begin, end] : buffer->events)
+        {
+            stream << (is_first ? "\n" : ",\n");
+            is_first = false;
+            stream << "{\"name\":" << std::quoted(name)
+                << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+                << ",\"ts\":" << to_microseconds(begin - trace_start)
+                << ",\"dur\":" << to_microseconds(end - begin) << '}';
+        }
+    }
+    stream << "\n]}\n";
+}
+
+void write_trace(const std::string& filename)
+{
+    std::ofstream file{filename};
+    if (not file.is_open())
+    {
+        throw std::logic_error{CONCAT("File ", filename, " could not be open")};
+    }
+    write_trace(file);
+}
+} // namespace utility
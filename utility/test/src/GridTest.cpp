@@ -0,0 +1,116 @@
+#include "utility/Grid.hpp"
+#include "utility/Stream.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+std::string to_string(std::span<const char> row)
+{
+    return std::string{row.begin(), row.end()};
+}
+
+TEST(GridTest, ConvertsBetweenCoordinatesAndIndices)
+{
+    const utility::Grid<int> grid{4, 3, 0, 2};
+    EXPECT_EQ(grid.get_width(), 4);
+    EXPECT_EQ(grid.get_height(), 3);
+    EXPECT_EQ(grid.get_cells().size(), 8u * 7u);
+    for (auto y = 0; y < grid.get_height(); ++y)
+    {
+        for (auto x = 0; x < grid.get_width(); ++x)
+        {
+            const auto index = grid.to_index(x, y);
+            EXPECT_EQ(grid.get_x(index), x);
+            EXPECT_EQ(grid.get_y(index), y);
+        }
+    }
+    EXPECT_EQ(grid.to_index(0, 0), 2 * 8 + 2);
+}
+
+TEST(GridTest, ReachesNeighboursThroughOffsets)
+{
+    utility::Grid<int> grid{3, 3, 0, 1};
+    for (auto y = 0; y < 3; ++y)
+    {
+        for (auto x = 0; x < 3; ++x)
+        {
+            grid.at(x, y) = 10 * y + x;
+        }
+    }
+    const auto center = grid.to_index(1, 1);
+    std::vector<int> neighbours;
+    for (const auto offset : grid.get_neighbour_offsets())
+    {
+        neighbours.push_back(grid[center + offset]);
+    }
+    EXPECT_EQ(neighbours, (std::vector<int>{0, 1, 2, 10, 12, 20, 21, 22}));
+    EXPECT_EQ(grid[center + grid.get_offset(1, 0)], 12);
+    EXPECT_EQ(grid[center + grid.get_offset(0, -1)], 1);
+}
+
+TEST(GridTest, ChecksBounds)
+{
+    const utility::Grid<char> grid{2, 3, '.'};
+    EXPECT_TRUE(grid.is_within_bounds(0, 0));
+    EXPECT_TRUE(grid.is_within_bounds(1, 2));
+    EXPECT_FALSE(grid.is_within_bounds(2, 0));
+    EXPECT_FALSE(grid.is_within_bounds(0, 3));
+    EXPECT_FALSE(grid.is_within_bounds(-1, 0));
+}
+
+TEST(GridTest, RejectsCellsOfWrongSize)
+{
+    EXPECT_THROW((utility::Grid<int>{2, 2, 1, std::vector<int>(4)}), std::invalid_argument);
+    EXPECT_NO_THROW((utility::Grid<int>{2, 2, 1, std::vector<int>(16)}));
+}
+
+TEST(GridTest, ParsesRowsOfStream)
+{
+    utility::Stream stream{std::string_view{"ab\ncd\nef\n"}};
+    const auto grid = utility::parse_grid(stream);
+    EXPECT_EQ(grid.get_width(), 2);
+    EXPECT_EQ(grid.get_height(), 3);
+    EXPECT_EQ(to_string(grid.get_row(0)), "ab");
+    EXPECT_EQ(to_string(grid.get_row(2)), "ef");
+    EXPECT_EQ(grid.at(1, 1), 'd');
+}
+
+TEST(GridTest, SurroundsParsedRowsWithBorder)
+{
+    utility::Stream stream{std::string_view{"ab\ncd"}};
+    const auto grid = utility::parse_grid(stream, '#', 1);
+    EXPECT_EQ(to_string(grid.get_row(1)), "cd");
+    EXPECT_EQ(grid.at(-1, -1), '#');
+    EXPECT_EQ(grid.at(2, 1), '#');
+    EXPECT_EQ(grid.at(0, 2), '#');
+    EXPECT_EQ(std::ranges::count(grid.get_cells(), '#'), 12);
+}
+
+TEST(GridTest, SkipsEmptyLines)
+{
+    utility::Stream stream{std::string_view{"\nab\n\ncd\n\n"}};
+    const auto grid = utility::parse_grid(stream);
+    EXPECT_EQ(grid.get_height(), 2);
+    EXPECT_EQ(to_string(grid.get_row(1)), "cd");
+}
+
+TEST(GridTest, ParsesEmptyStream)
+{
+    utility::Stream stream{std::string_view{}};
+    const auto grid = utility::parse_grid(stream, '#', 1);
+    EXPECT_EQ(grid.get_width(), 0);
+    EXPECT_EQ(grid.get_height(), 0);
+}
+
+TEST(GridTest, RejectsRowsOfDifferentLengths)
+{
+    utility::Stream stream{std::string_view{"abc\nde\n"}};
+    EXPECT_THROW(utility::parse_grid(stream), std::invalid_argument);
+}
+} // namespace
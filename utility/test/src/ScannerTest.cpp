@@ -0,0 +1,105 @@
+#include "utility/Scanner.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+std::vector<unsigned long> collect(utility::Integers<unsigned long> integers)
+{
+    std::vector<unsigned long> values;
+    for (const auto value : integers)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+TEST(ScannerTest, ReadsIntegersAndText)
+{
+    const auto [id, name, offset] = utility::scan<"Item {u}: {s} at {i}">("Item 17: blue box at -42");
+    EXPECT_EQ(id, 17ul);
+    EXPECT_EQ(name, "blue box");
+    EXPECT_EQ(offset, -42l);
+}
+
+TEST(ScannerTest, ReadsLists)
+{
+    const auto [id, winning, owned] = utility::scan<"Card {u}: {list} | {list}">("Card 1: 41 48 83 | 83 86  6 31");
+    EXPECT_EQ(id, 1ul);
+    EXPECT_EQ(collect(winning), (std::vector<unsigned long>{41, 48, 83}));
+    EXPECT_EQ(collect(owned), (std::vector<unsigned long>{83, 86, 6, 31}));
+}
+
+TEST(ScannerTest, MatchesSpaceOfFormatWithAnyNumberOfSpaces)
+{
+    EXPECT_EQ(std::get<0>(utility::scan<"Card {u}:">("Card   3:")), 3ul);
+    EXPECT_EQ(std::get<0>(utility::scan<"Card {u}:">("Card3:")), 3ul);
+}
+
+TEST(ScannerTest, TextRunsUntilNextLiteral)
+{
+    const auto [first, second] = utility::scan<"{s} = {s}">("AAA = (BBB, CCC)");
+    EXPECT_EQ(first, "AAA");
+    EXPECT_EQ(second, "(BBB, CCC)");
+}
+
+TEST(ScannerTest, ReadsEmptyFields)
+{
+    const auto [text, list] = utility::scan<"[{s}] {list}">("[] ");
+    EXPECT_EQ(text, "");
+    EXPECT_TRUE(collect(list).empty());
+}
+
+TEST(ScannerTest, ThrowsOnMismatchedLiteral)
+{
+    EXPECT_THROW(utility::scan<"Card {u}: {list}">("Game 1: 2 3"), std::invalid_argument);
+    EXPECT_THROW(utility::scan<"{s} | {s}">("left right"), std::invalid_argument);
+}
+
+TEST(ScannerTest, ThrowsOnMissingInteger)
+{
+    EXPECT_THROW(utility::scan<"Card {u}:">("Card x:"), std::invalid_argument);
+    EXPECT_THROW(utility::scan<"Offset {u}">("Offset -3"), std::invalid_argument);
+}
+
+TEST(ScannerTest, ThrowsOnIntegerOutOfRange)
+{
+    EXPECT_THROW(utility::scan<"{u}">("99999999999999999999999"), std::invalid_argument);
+}
+
+TEST(ScannerTest, ThrowsOnTrailingCharacters)
+{
+    EXPECT_THROW(utility::scan<"Card {u}:">("Card 1: extra"), std::invalid_argument);
+}
+
+TEST(ScannerTest, ThrowsOnEmptyLine)
+{
+    EXPECT_THROW(utility::scan<"Card {u}: {list}">(""), std::invalid_argument);
+    EXPECT_THROW(utility::scan<"{u} {u}">(""), std::invalid_argument);
+}
+
+TEST(ScannerTest, MatchesEmptyLineOnlyToFieldsWhichMayBeEmpty)
+{
+    EXPECT_EQ(std::get<0>(utility::scan<"{s}">("")), "");
+    EXPECT_TRUE(collect(std::get<0>(utility::scan<"{list}">(""))).empty());
+}
+
+TEST(ScannerTest, ReportsLineAndFormatOnMismatch)
+{
+    try
+    {
+        utility::scan<"Card {u}">("Game 1");
+        FAIL() << "Mismatch was not reported";
+    }
+    catch (const std::invalid_argument& error)
+    {
+        const std::string message{error.what()};
+        EXPECT_NE(message.find("\"Game 1\""), std::string::npos) << message;
+        EXPECT_NE(message.find("\"Card {u}\""), std::string::npos) << message;
+    }
+}
+} // namespace
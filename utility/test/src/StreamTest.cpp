@@ -0,0 +1,137 @@
+#include "utility/Source.hpp"
+#include "utility/Stream.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+// Hands out the input in chunks of a fixed size, so that lines span several chunks.
+class ChunkedSource : public utility::Source
+{
+public:
+    ChunkedSource(std::string_view input, std::size_t chunk_size) : input{input}, chunk_size{chunk_size}
+    {
+    }
+
+    std::string_view read() override
+    {
+        const auto chunk = input.substr(0, std::min(chunk_size, input.size()));
+        input.remove_prefix(chunk.size());
+        return chunk;
+    }
+
+private:
+    std::string_view input;
+    std::size_t chunk_size;
+};
+
+std::vector<std::string> read_lines(utility::Stream& stream)
+{
+    std::vector<std::string> lines;
+    for (const auto line : stream)
+    {
+        lines.emplace_back(line);
+    }
+    return lines;
+}
+
+std::vector<std::string> read_lines(std::string_view input)
+{
+    utility::Stream stream{input};
+    return read_lines(stream);
+}
+
+using Lines = std::vector<std::string>;
+
+TEST(StreamTest, SplitsInputWithTrailingNewline)
+{
+    EXPECT_EQ(read_lines("first\nsecond\n"), (Lines{"first", "second"}));
+}
+
+TEST(StreamTest, SplitsInputWithoutTrailingNewline)
+{
+    EXPECT_EQ(read_lines("first\nsecond"), (Lines{"first", "second"}));
+}
+
+TEST(StreamTest, KeepsEmptyLinesInside)
+{
+    EXPECT_EQ(read_lines("first\n\nsecond\n"), (Lines{"first", "", "second"}));
+    EXPECT_EQ(read_lines("\nfirst"), (Lines{"", "first"}));
+}
+
+TEST(StreamTest, KeepsEmptyLineBeforeTrailingNewline)
+{
+    EXPECT_EQ(read_lines("first\n\n"), (Lines{"first", ""}));
+    EXPECT_EQ(read_lines("\n"), (Lines{""}));
+}
+
+TEST(StreamTest, HandsOutNoLinesOfEmptyInput)
+{
+    EXPECT_TRUE(read_lines("").empty());
+}
+
+TEST(StreamTest, StripsCarriageReturns)
+{
+    EXPECT_EQ(read_lines("first\r\nsecond\r\n"), (Lines{"first", "second"}));
+    EXPECT_EQ(read_lines("first\r\nsecond\r"), (Lines{"first", "second"}));
+    EXPECT_EQ(read_lines("first\r\n\r\n"), (Lines{"first", ""}));
+}
+
+TEST(StreamTest, JoinsLinesSpanningChunks)
+{
+    for (const auto input : {std::string_view{"first\n\nthird line\r\nlast"}, std::string_view{"first\n\nlast\n"}})
+    {
+        const auto expected = read_lines(input);
+        for (std::size_t chunk_size{1}; chunk_size <= input.size(); ++chunk_size)
+        {
+            ChunkedSource source{input, chunk_size};
+            utility::Stream stream{source};
+            EXPECT_EQ(read_lines(stream), expected) << "chunk size " << chunk_size;
+        }
+    }
+}
+
+TEST(StreamTest, ReadsFromIstream)
+{
+    for (const auto input : {"first\nsecond\n", "first\nsecond"})
+    {
+        std::istringstream text{input};
+        utility::Stream stream{text};
+        EXPECT_EQ(read_lines(stream), (Lines{"first", "second"}));
+    }
+}
+
+TEST(StreamTest, ReadsLinesOneByOne)
+{
+    utility::Stream stream{std::string_view{"first\nsecond\nthird\n"}};
+    EXPECT_TRUE(stream.is_active());
+    stream.skip();
+    EXPECT_EQ(stream.next_line(), "second");
+    EXPECT_EQ(stream.next_line(), "third");
+    EXPECT_FALSE(stream.is_active());
+    EXPECT_EQ(stream.next_line(), "");
+}
+
+TEST(StreamTest, TakesRemainingBuffer)
+{
+    utility::Stream stream{std::string_view{"first\nsecond\n"}};
+    stream.skip();
+    EXPECT_EQ(stream.take_buffer(), "second\n");
+    EXPECT_FALSE(stream.is_active());
+    EXPECT_EQ(stream.take_buffer(), std::nullopt);
+}
+
+TEST(StreamTest, DoesNotTakeBufferOfSource)
+{
+    std::istringstream text{"first\n"};
+    utility::Stream stream{text};
+    EXPECT_EQ(stream.take_buffer(), std::nullopt);
+    EXPECT_EQ(read_lines(stream), (Lines{"first"}));
+}
+} // namespace
@@ -0,0 +1,133 @@
+#include "utility/ThreadPool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Runs every test on a pool without workers, where tasks run on submission, and on pools with workers.
+class ThreadPoolTest : public testing::TestWithParam<unsigned>
+{
+protected:
+    utility::ThreadPool pool{GetParam()};
+};
+
+TEST_P(ThreadPoolTest, RunsEveryTaskOfGroup)
+{
+    std::atomic<int> sum{0};
+    utility::TaskGroup group{pool};
+    for (auto value = 1; value <= 100; ++value)
+    {
+        group.run([&sum, value]() { sum += value; });
+    }
+    group.wait();
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST_P(ThreadPoolTest, RethrowsExceptionOfTaskFromWait)
+{
+    std::atomic<int> finished_count{0};
+    utility::TaskGroup group{pool};
+    for (auto index = 0; index < 20; ++index)
+    {
+        group.run([&finished_count, index]() {
+            if (index == 7)
+            {
+                throw std::runtime_error{"task failed"};
+            }
+            ++finished_count;
+        });
+    }
+    EXPECT_THROW(
+        {
+            try
+            {
+                group.wait();
+            }
+            catch (const std::runtime_error& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "task failed");
+                throw;
+            }
+        },
+        std::runtime_error);
+    EXPECT_EQ(finished_count.load(), 19);
+}
+
+TEST_P(ThreadPoolTest, RethrowsOnlyFirstExceptionOnce)
+{
+    utility::TaskGroup group{pool};
+    for (auto index = 0; index < 10; ++index)
+    {
+        group.run([]() { throw std::logic_error{"task failed"}; });
+    }
+    EXPECT_THROW(group.wait(), std::logic_error);
+    EXPECT_NO_THROW(group.wait());
+}
+
+TEST_P(ThreadPoolTest, PropagatesExceptionThroughNestedGroups)
+{
+    utility::TaskGroup outer{pool};
+    for (auto index = 0; index < 4; ++index)
+    {
+        outer.run([this, index]() {
+            utility::TaskGroup inner{pool};
+            for (auto inner_index = 0; inner_index < 4; ++inner_index)
+            {
+                inner.run([index, inner_index]() {
+                    if (index == 2 and inner_index == 3)
+                    {
+                        throw std::out_of_range{"inner task failed"};
+                    }
+                });
+            }
+            inner.wait();
+        });
+    }
+    EXPECT_THROW(outer.wait(), std::out_of_range);
+}
+
+TEST_P(ThreadPoolTest, ReducesInOrder)
+{
+    const auto concatenate = [](std::string left, const std::string& right) { return left + right; };
+    const auto digit = [](std::size_t index) { return std::string(1, static_cast<char>('0' + index % 10)); };
+    std::string expected;
+    for (std::size_t index{0}; index < 1000; ++index)
+    {
+        expected += digit(index);
+    }
+    constexpr auto chunk_size = 7u;
+    EXPECT_EQ(utility::parallel_reduce(0, 1000, std::string{}, digit, concatenate, chunk_size, pool), expected);
+}
+
+TEST_P(ThreadPoolTest, PropagatesExceptionOfParallelReduce)
+{
+    const auto function = [](std::size_t index) {
+        if (index == 500)
+        {
+            throw std::invalid_argument{"bad index"};
+        }
+        return index;
+    };
+    constexpr auto chunk_size = 10u;
+    EXPECT_THROW(
+        utility::parallel_reduce(0, 1000, std::size_t{0}, function, std::plus<>{}, chunk_size, pool),
+        std::invalid_argument);
+}
+
+TEST_P(ThreadPoolTest, VisitsEveryIndexOnce)
+{
+    std::vector<std::atomic<int>> visits(1000);
+    utility::parallel_for(0, visits.size(), [&visits](std::size_t index) { ++visits[index]; }, 0, pool);
+    for (const auto& visit : visits)
+    {
+        ASSERT_EQ(visit.load(), 1);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, ThreadPoolTest, testing::Values(1u, 2u, 4u));
+} // namespace
@@ -0,0 +1,143 @@
+#include "utility/CpuFeatures.hpp"
+#include "utility/Tokenizer.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+const char* find_integer_start_naively(const char* first, const char* last, bool is_signed)
+{
+    const auto is_integer_start = [is_signed](char c) { return (c >= '0' and c <= '9') or (is_signed and c == '-'); };
+    return std::find_if(first, last, is_integer_start);
+}
+
+std::vector<long> collect(std::string_view string)
+{
+    std::vector<long> values;
+    for (const auto value : utility::Integers<long>{string})
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+// Runs under the level named by AOC_ISA, so that ctest covers each kernel variant.
+TEST(TokenizerTest, UsesKernelSelectedByEnvironment)
+{
+    const auto* variable = std::getenv("AOC_ISA");
+    if (variable == nullptr)
+    {
+        GTEST_SKIP() << "AOC_ISA is not set";
+    }
+    const auto isas = {utility::Isa::scalar, utility::Isa::sse2, utility::Isa::avx2};
+    const auto requested = std::ranges::find(isas, std::string_view{variable}, utility::get_isa_name);
+    ASSERT_NE(requested, isas.end()) << "Unknown instruction set " << variable;
+    if (*requested > utility::get_supported_isa())
+    {
+        GTEST_SKIP() << variable << " is not supported by this machine";
+    }
+    EXPECT_EQ(utility::get_selected_isa(), *requested);
+}
+
+// Places a single character at every offset of inputs long enough to cover the vector loop and its scalar tail.
+TEST(TokenizerTest, FindsIntegerStartAtEveryOffset)
+{
+    for (const auto c : {'0', '5', '9', '-'})
+    {
+        for (const auto is_signed : {false, true})
+        {
+            for (std::size_t size{0}; size <= 100; ++size)
+            {
+                for (std::size_t offset{0}; offset <= size; ++offset)
+                {
+                    std::string text(size, 'x');
+                    if (offset < size)
+                    {
+                        text[offset] = c;
+                    }
+                    const auto* first = text.data();
+                    const auto* last = text.data() + text.size();
+                    ASSERT_EQ(utility::find_integer_start(first, last, is_signed),
+                              find_integer_start_naively(first, last, is_signed))
+                        << "character " << c << ", size " << size << ", offset " << offset << ", signed " << is_signed;
+                }
+            }
+        }
+    }
+}
+
+// Bytes next to the digits in ASCII, and ones which wrap around when the digit offset is subtracted, are no digits.
+TEST(TokenizerTest, IgnoresCharactersAroundDigits)
+{
+    std::string text;
+    for (const auto c : {'/', ':', ' ', '+', '\0', '\x80', '\xff', '\xb0', '\xb9'})
+    {
+        text.append(40, c);
+    }
+    const auto* first = text.data();
+    const auto* last = text.data() + text.size();
+    EXPECT_EQ(utility::find_integer_start(first, last, true), last);
+    text.back() = '7';
+    EXPECT_EQ(utility::find_integer_start(first, last, true), last - 1);
+}
+
+TEST(TokenizerTest, IgnoresMinusOfUnsignedIntegers)
+{
+    const std::string text(50, '-');
+    EXPECT_EQ(utility::find_integer_start(text.data(), text.data() + text.size(), false), text.data() + text.size());
+    EXPECT_EQ(utility::find_integer_start(text.data(), text.data() + text.size(), true), text.data());
+}
+
+TEST(TokenizerTest, ReadsIntegersSeparatedByText)
+{
+    EXPECT_EQ(collect("Game 12: 3 blue, -4 red; 56"), (std::vector<long>{12, 3, -4, 56}));
+    EXPECT_EQ(collect(""), std::vector<long>{});
+    EXPECT_EQ(collect("no numbers here, not even past the width of a vector register"), std::vector<long>{});
+}
+
+TEST(TokenizerTest, SkipsMinusWithoutDigits)
+{
+    EXPECT_EQ(collect("a - b -7 --8"), (std::vector<long>{-7, -8}));
+}
+
+TEST(TokenizerTest, ReadsMinusAsSeparatorOfUnsignedIntegers)
+{
+    std::vector<unsigned> values;
+    for (const auto value : utility::Integers<unsigned>{"3-4 -5"})
+    {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, (std::vector<unsigned>{3, 4, 5}));
+}
+
+TEST(TokenizerTest, ReadsIntegersAfterLongGaps)
+{
+    const auto text = std::string(70, ' ') + "123" + std::string(33, '.') + "-45";
+    EXPECT_EQ(collect(text), (std::vector<long>{123, -45}));
+}
+
+TEST(TokenizerTest, ThrowsOnIntegerOutOfRange)
+{
+    std::vector<int> values;
+    EXPECT_THROW(
+        {
+            for (const auto value : utility::Integers<int>{"1 99999999999"})
+            {
+                values.push_back(value);
+            }
+        },
+        std::out_of_range);
+}
+
+TEST(TokenizerTest, ParsesFixedNumberOfIntegers)
+{
+    EXPECT_EQ((utility::parse_integers<int, 3>("1, 2, 3, 4")), (std::array<int, 3>{1, 2, 3}));
+    EXPECT_THROW((utility::parse_integers<int, 3>("1, 2")), std::invalid_argument);
+}
+} // namespace
@@ -0,0 +1,317 @@
+#include "utility/Arguments.hpp"
+#include "utility/Dbg.hpp"
+#include "utility/Hash.hpp"
+#include "utility/MappedFile.hpp"
+#include "utility/Registry.hpp"
+#include "utility/Scanner.hpp"
+#include "utility/Stream.hpp"
+#include "utility/ThreadPool.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct UpdateStats
+{
+    std::size_t line_count, evaluated_count;
+};
+
+// Length of the common prefix of the texts. Whole blocks are compared with memcmp, so that an unchanged prefix costs
+// about as much as copying it.
+std::size_t get_common_prefix_length(std::string_view lhs, std::string_view rhs)
+{
+    constexpr std::size_t block_size{4096};
+    const auto size = std::min(lhs.size(), rhs.size());
+    std::size_t offset{0};
+    while (size - offset >= block_size and std::memcmp(lhs.data() + offset, rhs.data() + offset, block_size) == 0)
+    {
+        offset += block_size;
+    }
+    const auto [lhs_itr, rhs_itr] = std::mismatch(lhs.begin() + offset, lhs.begin() + size, rhs.begin() + offset);
+    return static_cast<std::size_t>(lhs_itr - lhs.begin());
+}
+
+// Sum of the terms of all lines. The lines of the previous text which end before the first changed byte are kept
+// with their terms as they are, so appending to the text only costs comparing the old part and reading the new one.
+// The following lines are looked up by their hash among the terms of the lines which were present before, and only
+// the lines which were not are evaluated. Terms of lines which are gone are forgotten.
+class LineSum
+{
+public:
+    explicit LineSum(utility::LineTerm line_term) : line_term{std::move(line_term)}
+    {
+    }
+
+    utility::SolverAnswer update(std::string_view new_text, UpdateStats& stats)
+    {
+        const auto common_length = get_common_prefix_length(text, new_text);
+        const auto kept_itr = std::ranges::partition_point(
+            lines, [common_length](const Line& line) { return line.next_offset <= common_length; });
+        const auto resume_offset = kept_itr == lines.begin() ? 0 : std::prev(kept_itr)->next_offset;
+
+        // Terms of the dropped lines stay until the new lines are looked up, so that moved lines are not evaluated.
+        std::vector<std::uint64_t> dropped_hashes;
+        for (auto line_itr = kept_itr; line_itr != lines.end(); ++line_itr)
+        {
+            --terms.at(line_itr->hash).line_count;
+            dropped_hashes.push_back(line_itr->hash);
+        }
+        lines.erase(kept_itr, lines.end());
+        text.resize(resume_offset);
+        text.append(new_text.substr(resume_offset));
+
+        const auto kept_count = lines.size();
+        std::vector<std::string_view> missing_lines;
+        std::vector<std::uint64_t> missing_hashes;
+        utility::Stream stream{std::string_view{text}.substr(resume_offset)};
+        for (const auto& line : stream)
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            // Lines are views into the text, so the newline ending a line is the first one after it.
+            const auto end_offset = static_cast<std::size_t>(line.data() + line.size() - text.data());
+            const auto newline_offset = text.find('\n', end_offset);
+            const auto next_offset = newline_offset == std::string::npos ? std::string::npos : newline_offset + 1;
+            const auto hash = utility::hash_text(line);
+            auto& term = terms[hash];
+            if (term.line_count++ == 0 and not term.is_evaluated)
+            {
+                missing_lines.push_back(line);
+                missing_hashes.push_back(hash);
+            }
+            lines.push_back(Line{next_offset, hash});
+        }
+
+        std::vector<utility::SolverAnswer> missing_terms(missing_lines.size());
+        utility::parallel_for(0, missing_lines.size(), [&](std::size_t index) {
+            missing_terms[index] = line_term(missing_lines[index]);
+        });
+        for (auto index = 0u; index < missing_lines.size(); ++index)
+        {
+            auto& term = terms.at(missing_hashes[index]);
+            term.value = missing_terms[index];
+            term.is_evaluated = true;
+        }
+        for (const auto hash : dropped_hashes)
+        {
+            if (const auto term_itr = terms.find(hash); term_itr != terms.end() and term_itr->second.line_count == 0)
+            {
+                terms.erase(term_itr);
+            }
+        }
+
+        sums.resize(kept_count);
+        for (auto index = kept_count; index < lines.size(); ++index)
+        {
+            sums.push_back((sums.empty() ? 0 : sums.back()) + terms.at(lines[index].hash).value);
+        }
+        stats = UpdateStats{lines.size(), missing_lines.size()};
+        return sums.empty() ? 0 : sums.back();
+    }
+
+private:
+    struct Line
+    {
+        // Offset after the newline ending the line, or npos when the text ends with the line.
+        std::size_t next_offset;
+        std::uint64_t hash;
+    };
+
+    // Term shared by the lines with the same hash.
+    struct Term
+    {
+        utility::SolverAnswer value{0};
+        std::size_t line_count{0};
+        bool is_evaluated{false};
+    };
+
+    utility::LineTerm line_term;
+    std::string text;
+    std::vector<Line> lines;
+    // Sum of the terms of each line and the ones before it.
+    std::vector<utility::SolverAnswer> sums;
+    std::unordered_map<std::uint64_t, Term> terms;
+};
+
+// Blocks until the watched file changes. Its directory is watched, so that files replaced by a rename are noticed
+// too, and events arriving within 20 ms of each other are handled as a single change.
+class FileWatch
+{
+public:
+    explicit FileWatch(const std::filesystem::path& path) : fd{::inotify_init1(IN_CLOEXEC)}, name{path.filename()}
+    {
+        if (fd < 0)
+        {
+            throw std::logic_error{CONCAT("Inotify could not be initialised: ", std::strerror(errno))};
+        }
+        const auto directory = path.parent_path().empty() ? std::filesystem::path{"."} : path.parent_path();
+        constexpr auto events = IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE;
+        if (::inotify_add_watch(fd, directory.c_str(), events) < 0)
+        {
+            ::close(fd);
+            throw std::logic_error{
+                CONCAT("Directory ", directory.string(), " could not be watched: ", std::strerror(errno))};
+        }
+    }
+
+    FileWatch(const FileWatch&) = delete;
+
+    FileWatch& operator=(const FileWatch&) = delete;
+
+    ~FileWatch()
+    {
+        ::close(fd);
+    }
+
+    void wait_for_change()
+    {
+        constexpr auto quiet_time_ms = 20;
+        auto is_changed = false;
+        while (true)
+        {
+            pollfd poll_fd{fd, POLLIN, 0};
+            const auto ready = ::poll(&poll_fd, 1, is_changed ? quiet_time_ms : -1);
+            if (ready < 0 and errno != EINTR)
+            {
+                throw std::logic_error{CONCAT("Inotify could not be polled: ", std::strerror(errno))};
+            }
+            if (ready == 0)
+            {
+                return;
+            }
+            if (ready > 0)
+            {
+                is_changed = read_events() or is_changed;
+            }
+        }
+    }
+
+private:
+    int fd;
+    std::filesystem::path name;
+
+    bool read_events()
+    {
+        alignas(inotify_event) char buffer[4096];
+        const auto size = ::read(fd, buffer, sizeof(buffer));
+        if (size < 0)
+        {
+            return false;
+        }
+        auto is_changed = false;
+        for (auto offset = 0l; offset < size;)
+        {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 and name == event->name)
+            {
+                is_changed = true;
+            }
+            offset += static_cast<long>(sizeof(inotify_event) + event->len);
+        }
+        return is_changed;
+    }
+};
+
+utility::SolverId parse_solver_id(std::string_view name)
+{
+    const auto [day, part] = utility::scan<"d{u}p{u}">(name);
+    const utility::SolverId id{static_cast<unsigned>(day), static_cast<unsigned>(part)};
+    if (not utility::get_solvers().contains(id))
+    {
+        throw std::invalid_argument{CONCAT("No solver named ", std::quoted(name))};
+    }
+    return id;
+}
+
+double to_milliseconds(Clock::duration time)
+{
+    return std::chrono::duration<double, std::milli>{time}.count();
+}
+} // namespace
+
+// Solves an input file, as `aoc-watch d12p2 day12/input.txt`, and solves it again whenever the file changes.
+// For solvers whose answer is a sum of independent terms of lines only the added and changed lines are evaluated,
+// the others are solved in full.
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const auto args = utility::parse_arguments(argc, argv);
+        const auto is_positional = [](std::string_view argument) { return not argument.starts_with("--"); };
+        auto positional_args = args | std::views::drop(1) | std::views::filter(is_positional);
+        if (std::ranges::distance(positional_args) != 2)
+        {
+            throw std::invalid_argument{"Usage: aoc-watch <solver> <input file>"};
+        }
+        const auto solver_name = *positional_args.begin();
+        const std::filesystem::path input_path{*std::next(positional_args.begin())};
+        const auto id = parse_solver_id(solver_name);
+        const auto& line_terms = utility::get_line_terms();
+        std::optional<LineSum> line_sum;
+        if (const auto line_term_itr = line_terms.find(id); line_term_itr != line_terms.end())
+        {
+            line_sum.emplace(line_term_itr->second);
+        }
+
+        FileWatch watch{input_path};
+        std::cerr << std::fixed << std::setprecision(3);
+        while (true)
+        {
+            try
+            {
+                const auto start = Clock::now();
+                const auto input_file = utility::map_file(input_path.string());
+                const auto contents = input_file.get_contents();
+                UpdateStats stats{0, 0};
+                const auto answer = [&] {
+                    if (line_sum.has_value())
+                    {
+                        return line_sum->update(contents, stats);
+                    }
+                    utility::Stream stream{contents};
+                    return utility::get_solvers().at(id)(stream);
+                }();
+                const auto time = Clock::now() - start;
+                std::cout << solver_name << " answer:" << answer << std::endl;
+                std::cerr << "Solved in " << to_milliseconds(time) << " ms";
+                if (line_sum.has_value())
+                {
+                    std::cerr << ", evaluated " << stats.evaluated_count << " of " << stats.line_count << " lines";
+                }
+                std::cerr << std::endl;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Exception: ", e.what());
+            }
+            watch.wait_for_change();
+        }
+    }
+    catch(const std::exception& e)
+    {
+        LOG_ERROR("Exception: ", e.what());
+        return 1;
+    }
+}